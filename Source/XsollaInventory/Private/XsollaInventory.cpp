@@ -2,7 +2,9 @@
 
 #include "XsollaInventory.h"
 
+#include "XsollaInventoryDataModel.h"
 #include "XsollaInventoryDefines.h"
+#include "XsollaUtilsJsonStructDecoder.h"
 
 #include "Developer/Settings/Public/ISettingsModule.h"
 
@@ -10,11 +12,27 @@
 
 void FXsollaInventoryModule::StartupModule()
 {
+	// Inventory items are decoded without per-field reflection
+	TXsollaJsonStructDecoder<FInventoryItem>()
+		.Field("sku", &FInventoryItem::sku)
+		.Field("name", &FInventoryItem::name)
+		.Field("type", &FInventoryItem::type)
+		.Field("virtual_item_type", &FInventoryItem::virtual_item_type)
+		.Field("description", &FInventoryItem::description)
+		.Field("image_url", &FInventoryItem::image_url)
+		.Field("attributes", &FInventoryItem::attributes)
+		.Field("groups", &FInventoryItem::groups)
+		.Field("instance_id", &FInventoryItem::instance_id)
+		.Field("quantity", &FInventoryItem::quantity)
+		.Field("remaining_uses", &FInventoryItem::remaining_uses)
+		.Register();
+
 	UE_LOG(LogXsollaInventory, Log, TEXT("%s: XsollaInventory module started"), *VA_FUNC_LINE);
 }
 
 void FXsollaInventoryModule::ShutdownModule()
 {
+	TXsollaJsonStructDecoder<FInventoryItem>::Unregister();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -76,7 +76,7 @@ void UXsollaInventorySubsystem::GetInventory(const FString& AuthToken, const EXs
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this,
 			&UXsollaInventorySubsystem::GetInventory_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -107,7 +107,7 @@ void UXsollaInventorySubsystem::GetVirtualCurrencyBalance(const FString& AuthTok
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this,
 			&UXsollaInventorySubsystem::GetVirtualCurrencyBalance_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -138,7 +138,7 @@ void UXsollaInventorySubsystem::GetTimeLimitedItems(const FString& AuthToken, co
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this,
 			&UXsollaInventorySubsystem::GetTimeLimitedItems_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -196,7 +196,7 @@ void UXsollaInventorySubsystem::ConsumeInventoryItem(const FString& AuthToken, c
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, Token, SerializeJson(RequestDataJson));
 		HttpRequest->OnProcessRequestComplete().BindUObject(this,
 			&UXsollaInventorySubsystem::ConsumeInventoryItem_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -221,7 +221,7 @@ void UXsollaInventorySubsystem::GetCouponRewards(const FString& AuthToken, const
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this,
 			&UXsollaInventorySubsystem::UpdateCouponRewards_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -249,7 +249,7 @@ void UXsollaInventorySubsystem::RedeemCoupon(const FString& AuthToken, const FSt
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, Token, SerializeJson(RequestDataJson));
 		HttpRequest->OnProcessRequestComplete().BindUObject(this,
 			&UXsollaInventorySubsystem::RedeemCoupon_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -275,19 +275,17 @@ void UXsollaInventorySubsystem::GetInventory_HttpRequestComplete(
 	// Log HTTP response
 	XsollaUtilsLoggingHelper::LogHttpResponse(HttpRequest, HttpResponse);
 
-	XsollaHttpRequestError OutError;
-	FInventoryItemsData Inventory;
-
-	if (XsollaUtilsHttpRequestHelper::ParseResponseAsStruct(HttpRequest, HttpResponse, bSucceeded, FInventoryItemsData::StaticStruct(), &Inventory, OutError))
-	{
-		UE_LOG(LogXsollaInventory, Log, TEXT("%s: GetInventory request successful. Items count: %d."), *VA_FUNC_LINE, Inventory.Items.Num());
-		SuccessCallback.ExecuteIfBound(Inventory);
-	}
-	else
-	{
-		UE_LOG(LogXsollaInventory, Error, TEXT("%s: GetInventory request failed. Error: %s"), *VA_FUNC_LINE, *OutError.description);
-		LoginSubsystem->HandleRequestError(OutError, ErrorHandlersWrapper);
-	}
+	XsollaUtilsHttpRequestHelper::ParseResponseAsStructAsync<FInventoryItemsData>(this, HttpRequest, HttpResponse, bSucceeded,
+		[SuccessCallback](const FInventoryItemsData& Inventory)
+		{
+			UE_LOG(LogXsollaInventory, Log, TEXT("%s: GetInventory request successful. Items count: %d."), *VA_FUNC_LINE, Inventory.Items.Num());
+			SuccessCallback.ExecuteIfBound(Inventory);
+		},
+		[this, ErrorHandlersWrapper](const XsollaHttpRequestError& OutError)
+		{
+			UE_LOG(LogXsollaInventory, Error, TEXT("%s: GetInventory request failed. Error: %s"), *VA_FUNC_LINE, *OutError.description);
+			LoginSubsystem->HandleRequestError(OutError, ErrorHandlersWrapper);
+		});
 }
 
 void UXsollaInventorySubsystem::GetVirtualCurrencyBalance_HttpRequestComplete(
@@ -297,19 +295,17 @@ void UXsollaInventorySubsystem::GetVirtualCurrencyBalance_HttpRequestComplete(
 	// Log HTTP response
 	XsollaUtilsLoggingHelper::LogHttpResponse(HttpRequest, HttpResponse);
 
-	XsollaHttpRequestError OutError;
-	FVirtualCurrencyBalanceData VirtualCurrencyBalance;
-
-	if (XsollaUtilsHttpRequestHelper::ParseResponseAsStruct(HttpRequest, HttpResponse, bSucceeded, FVirtualCurrencyBalanceData::StaticStruct(), &VirtualCurrencyBalance, OutError))
-	{
-		UE_LOG(LogXsollaInventory, Log, TEXT("%s: GetVirtualCurrencyBalance request successful. Items count: %d."), *VA_FUNC_LINE, VirtualCurrencyBalance.Items.Num());
-		SuccessCallback.ExecuteIfBound(VirtualCurrencyBalance);
-	}
-	else
-	{
-		UE_LOG(LogXsollaInventory, Error, TEXT("%s: GetVirtualCurrencyBalance request failed. Error: %s"), *VA_FUNC_LINE, *OutError.description);
-		LoginSubsystem->HandleRequestError(OutError, ErrorHandlersWrapper);
-	}
+	XsollaUtilsHttpRequestHelper::ParseResponseAsStructAsync<FVirtualCurrencyBalanceData>(this, HttpRequest, HttpResponse, bSucceeded,
+		[SuccessCallback](const FVirtualCurrencyBalanceData& VirtualCurrencyBalance)
+		{
+			UE_LOG(LogXsollaInventory, Log, TEXT("%s: GetVirtualCurrencyBalance request successful. Items count: %d."), *VA_FUNC_LINE, VirtualCurrencyBalance.Items.Num());
+			SuccessCallback.ExecuteIfBound(VirtualCurrencyBalance);
+		},
+		[this, ErrorHandlersWrapper](const XsollaHttpRequestError& OutError)
+		{
+			UE_LOG(LogXsollaInventory, Error, TEXT("%s: GetVirtualCurrencyBalance request failed. Error: %s"), *VA_FUNC_LINE, *OutError.description);
+			LoginSubsystem->HandleRequestError(OutError, ErrorHandlersWrapper);
+		});
 }
 
 void UXsollaInventorySubsystem::GetTimeLimitedItems_HttpRequestComplete(
@@ -405,7 +401,9 @@ TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UXsollaInventorySubsystem::CreateH
 	UE_LOG(LogXsollaInventory, Log, TEXT("%s: Creating HTTP request - URL: %s, Verb: %s"),
 		*VA_FUNC_LINE, *Url, *XsollaUtilsLoggingHelper::VerbToString(Verb));
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = XsollaUtilsHttpRequestHelper::CreateHttpRequest(Url, Verb, AuthToken, Content, TEXT("INVENTORY"), XSOLLA_INVENTORY_VERSION);
+	static const FString SdkModuleName(TEXT("INVENTORY"));
+	static const FString SdkModuleVersion(XSOLLA_INVENTORY_VERSION);
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = XsollaUtilsHttpRequestHelper::CreateHttpRequest(Url, Verb, AuthToken, Content, SdkModuleName, SdkModuleVersion);
 
 	// Log request details
 	XsollaUtilsLoggingHelper::LogHttpRequest(HttpRequest, Content);
@@ -4,9 +4,7 @@
 #include "Common/TcpListener.h"
 #include "Sockets.h"
 #include "SocketSubsystem.h"
-#include "Async/Async.h"
 #include "GenericPlatform/GenericPlatformHttp.h"
-#include "HAL/PlatformProcess.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Interfaces/IPluginManager.h"
@@ -247,7 +245,14 @@ bool FXsollaLoginHttpServer::Start(int32 InPort, const FOnAuthParamsReceived& In
 
 	Listener->OnConnectionAccepted().BindRaw(this, &FXsollaLoginHttpServer::HandleConnectionAccepted);
 
-	return Listener->IsActive();
+	if (!Listener->IsActive())
+	{
+		return false;
+	}
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FXsollaLoginHttpServer::Tick));
+
+	return true;
 }
 
 void FXsollaLoginHttpServer::Stop()
@@ -259,6 +264,27 @@ void FXsollaLoginHttpServer::Stop()
 		delete Listener;
 		Listener = nullptr;
 	}
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	// Listener thread is stopped, so no sockets are added anymore
+	FSocket* AcceptedSocket = nullptr;
+	while (AcceptedSockets.Dequeue(AcceptedSocket))
+	{
+		FConnection Connection;
+		Connection.Socket = AcceptedSocket;
+		CloseConnection(Connection);
+	}
+
+	for (FConnection& Connection : Connections)
+	{
+		CloseConnection(Connection);
+	}
+	Connections.Empty();
 }
 
 int32 FXsollaLoginHttpServer::GetPort() const
@@ -273,108 +299,186 @@ bool FXsollaLoginHttpServer::HandleConnectionAccepted(FSocket* ClientSocket, con
 		return false;
 	}
 
-	TArray<uint8> ReceivedData;
-	uint32 PendingDataSize = 0;
+	// Connection is owned by the server from now on and served without blocking the listener thread
+	ClientSocket->SetNonBlocking(true);
+	AcceptedSockets.Enqueue(ClientSocket);
+
+	return true;
+}
+
+bool FXsollaLoginHttpServer::Tick(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+
+	FSocket* AcceptedSocket = nullptr;
+	while (AcceptedSockets.Dequeue(AcceptedSocket))
+	{
+		FConnection& Connection = Connections.AddDefaulted_GetRef();
+		Connection.Socket = AcceptedSocket;
+		Connection.AcceptTime = Now;
+	}
+
+	// Delegate is executed after all connections are served since it may stop the server
+	TArray<FAuthParamsMap> ReceivedParams;
 
-	// Simple read with timeout/retries could be better, but for now we assume request comes quickly
-	int32 RetryCount = 0;
-	while (RetryCount < 10)
+	for (int32 Index = Connections.Num() - 1; Index >= 0; --Index)
 	{
-		if (ClientSocket->HasPendingData(PendingDataSize) && PendingDataSize > 0)
+		FConnection& Connection = Connections[Index];
+
+		bool bKeepOpen = true;
+		if (Connection.Response.Num() == 0)
 		{
-			ReceivedData.SetNumUninitialized(PendingDataSize);
-			int32 BytesRead = 0;
-			if (ClientSocket->Recv(ReceivedData.GetData(), PendingDataSize, BytesRead))
-			{
-				ReceivedData.SetNum(BytesRead);
-				break;
-			}
+			bKeepOpen = ReceiveRequest(Connection, ReceivedParams);
+		}
+
+		if (bKeepOpen && Connection.Response.Num() > 0)
+		{
+			bKeepOpen = SendResponse(Connection) && Connection.BytesSent < Connection.Response.Num();
+		}
+
+		if (bKeepOpen && Now - Connection.AcceptTime > ConnectionTimeout)
+		{
+			UE_LOG(LogXsollaLogin, Verbose, TEXT("%s: Connection timed out"), *VA_FUNC_LINE);
+			bKeepOpen = false;
+		}
+
+		if (!bKeepOpen)
+		{
+			CloseConnection(Connection);
+			Connections.RemoveAtSwap(Index);
 		}
-		FPlatformProcess::Sleep(0.01f);
-		RetryCount++;
 	}
 
-	if (ReceivedData.Num() == 0)
+	const FOnAuthParamsReceived Delegate = OnAuthParamsReceivedDelegate;
+	for (const FAuthParamsMap& Params : ReceivedParams)
 	{
-		ClientSocket->Close();
-		return false;
+		Delegate.ExecuteIfBound(Params);
+	}
+
+	return true;
+}
+
+bool FXsollaLoginHttpServer::ReceiveRequest(FConnection& Connection, TArray<FAuthParamsMap>& OutReceivedParams)
+{
+	uint8 Buffer[4096];
+	int32 BytesRead = 0;
+
+	// Non-blocking socket reports success with no data when there is nothing to read yet
+	while (Connection.Socket->Recv(Buffer, sizeof(Buffer), BytesRead))
+	{
+		if (BytesRead == 0)
+		{
+			return true;
+		}
+
+		// Headers end may be split between reads
+		const int32 SearchStart = FMath::Max(Connection.Request.Num() - 3, 0);
+		Connection.Request.Append(Buffer, BytesRead);
+
+		for (int32 Index = SearchStart; Index + 3 < Connection.Request.Num(); ++Index)
+		{
+			if (Connection.Request[Index] == '\r' && Connection.Request[Index + 1] == '\n'
+				&& Connection.Request[Index + 2] == '\r' && Connection.Request[Index + 3] == '\n')
+			{
+				// Request body isn't used, the callback parameters are in the query string
+				Connection.Request.SetNum(Index);
+				HandleRequest(Connection, OutReceivedParams);
+				return true;
+			}
+		}
+
+		if (Connection.Request.Num() > MaxRequestSize)
+		{
+			UE_LOG(LogXsollaLogin, Warning, TEXT("%s: Request headers are too large"), *VA_FUNC_LINE);
+			return false;
+		}
 	}
 
-	ReceivedData.Add(0); // Null terminator
-	FString RequestString = FString(UTF8_TO_TCHAR(reinterpret_cast<const char*>(ReceivedData.GetData())));
+	// Connection is closed by the client or failed
+	return false;
+}
+
+void FXsollaLoginHttpServer::HandleRequest(FConnection& Connection, TArray<FAuthParamsMap>& OutReceivedParams)
+{
+	const FString RequestString(Connection.Request.Num(), reinterpret_cast<const UTF8CHAR*>(Connection.Request.GetData()));
 
 	bool bHasError = false;
 
 	// Parse Request Line: GET /?code=... HTTP/1.1
 	FString RequestLine;
 	FString Leftover;
-	if (RequestString.Split(TEXT("\r\n"), &RequestLine, &Leftover))
+	if (!RequestString.Split(TEXT("\r\n"), &RequestLine, &Leftover))
+	{
+		RequestLine = RequestString;
+	}
+
+	TArray<FString> Parts;
+	RequestLine.ParseIntoArray(Parts, TEXT(" "), true);
+
+	if (Parts.Num() >= 2 && Parts[0] == TEXT("GET"))
 	{
-		TArray<FString> Parts;
-		RequestLine.ParseIntoArray(Parts, TEXT(" "), true);
+		FString Url = Parts[1];
+		FString QueryParams;
+		FString UrlPath;
 
-		if (Parts.Num() >= 2 && Parts[0] == TEXT("GET"))
+		if (Url.Split(TEXT("?"), &UrlPath, &QueryParams))
 		{
-			FString Url = Parts[1];
-			FString QueryParams;
-			FString UrlPath;
+			TMap<FString, FString> Params;
+			TArray<FString> ParamPairs;
+			QueryParams.ParseIntoArray(ParamPairs, TEXT("&"), true);
 
-			if (Url.Split(TEXT("?"), &UrlPath, &QueryParams))
+			for (const FString& Pair : ParamPairs)
 			{
-				TMap<FString, FString> Params;
-				TArray<FString> ParamPairs;
-				QueryParams.ParseIntoArray(ParamPairs, TEXT("&"), true);
-
-				for (const FString& Pair : ParamPairs)
+				FString Key, Value;
+				if (Pair.Split(TEXT("="), &Key, &Value))
 				{
-					FString Key, Value;
-					if (Pair.Split(TEXT("="), &Key, &Value))
+					FString DecodedKey = FGenericPlatformHttp::UrlDecode(Key);
+					FString DecodedValue = FGenericPlatformHttp::UrlDecode(Value);
+					Params.Add(DecodedKey, DecodedValue);
+
+					if (DecodedKey == TEXT("error") || DecodedKey == TEXT("error_code"))
 					{
-						FString DecodedKey = FGenericPlatformHttp::UrlDecode(Key);
-						FString DecodedValue = FGenericPlatformHttp::UrlDecode(Value);
-						Params.Add(DecodedKey, DecodedValue);
-
-						if (DecodedKey == TEXT("error") || DecodedKey == TEXT("error_code"))
-						{
-							bHasError = true;
-						}
+						bHasError = true;
 					}
-					else
-					{
-						FString DecodedKey = FGenericPlatformHttp::UrlDecode(Pair);
-						Params.Add(DecodedKey, TEXT(""));
+				}
+				else
+				{
+					FString DecodedKey = FGenericPlatformHttp::UrlDecode(Pair);
+					Params.Add(DecodedKey, TEXT(""));
 
-						if (DecodedKey == TEXT("error") || DecodedKey == TEXT("error_code"))
-						{
-							bHasError = true;
-						}
+					if (DecodedKey == TEXT("error") || DecodedKey == TEXT("error_code"))
+					{
+						bHasError = true;
 					}
 				}
-
-				// Execute on Game Thread
-				AsyncTask(ENamedThreads::GameThread, [this, Params]()
-				{
-					OnAuthParamsReceivedDelegate.ExecuteIfBound(Params);
-				});
 			}
+
+			OutReceivedParams.Add(MoveTemp(Params));
 		}
 	}
 
-	// Send Response
-	FString HtmlContent;
-
 	// Use cached localized strings
 	FString Title = bHasError ? CachedErrorTitle : CachedSuccessTitle;
 	FString Message = bHasError ? CachedErrorMessage : CachedSuccessMessage;
 
-	HtmlContent = FString::Printf(TEXT("<html><head><title>%s</title><meta charset=\"utf-8\"></head><body><h1>%s</h1><p>%s</p></body></html>"), *Title, *Title, *Message);
-	SendResponse(ClientSocket, HtmlContent);
+	const FString HtmlContent = FString::Printf(TEXT("<html><head><title>%s</title><meta charset=\"utf-8\"></head><body><h1>%s</h1><p>%s</p></body></html>"), *Title, *Title, *Message);
+	FormatResponse(HtmlContent, Connection.Response);
+}
 
-	ClientSocket->Close();
+bool FXsollaLoginHttpServer::SendResponse(FConnection& Connection)
+{
+	int32 BytesSent = 0;
+	if (!Connection.Socket->Send(Connection.Response.GetData() + Connection.BytesSent, Connection.Response.Num() - Connection.BytesSent, BytesSent))
+	{
+		// Send buffer is full, the rest is sent on the next tick
+		return ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() == SE_EWOULDBLOCK;
+	}
+
+	Connection.BytesSent += BytesSent;
 	return true;
 }
 
-void FXsollaLoginHttpServer::SendResponse(FSocket* ClientSocket, const FString& Content)
+void FXsollaLoginHttpServer::FormatResponse(const FString& Content, TArray<uint8>& OutResponse) const
 {
 	// Calculate Content-Length using UTF-8 bytes length, not string length (which is number of TCHARs)
 	FTCHARToUTF8 Utf8Content(*Content);
@@ -383,7 +487,16 @@ void FXsollaLoginHttpServer::SendResponse(FSocket* ClientSocket, const FString&
 	FString FullResponse = Header + Content;
 	FTCHARToUTF8 Utf8Response(*FullResponse);
 
-	int32 BytesSent = 0;
-	ClientSocket->Send((const uint8*)Utf8Response.Get(), Utf8Response.Length(), BytesSent);
+	OutResponse.Reset();
+	OutResponse.Append(reinterpret_cast<const uint8*>(Utf8Response.Get()), Utf8Response.Length());
 }
 
+void FXsollaLoginHttpServer::CloseConnection(FConnection& Connection)
+{
+	if (Connection.Socket)
+	{
+		Connection.Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Connection.Socket);
+		Connection.Socket = nullptr;
+	}
+}
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
 #include "Interfaces/IPv4/IPv4Endpoint.h"
 
 class FTcpListener;
@@ -11,6 +13,12 @@ class FSocket;
 typedef TMap<FString, FString> FAuthParamsMap;
 DECLARE_DELEGATE_OneParam(FOnAuthParamsReceived, const FAuthParamsMap&);
 
+/**
+ * Local HTTP server receiving OAuth callback parameters.
+ *
+ * Accepted connections are served on the game thread with non-blocking sockets, so several connections
+ * (e.g. speculative ones opened by browsers) are handled concurrently and slow clients don't block others.
+ */
 class FXsollaLoginHttpServer
 {
 public:
@@ -22,8 +30,30 @@ public:
 	int32 GetPort() const;
 
 private:
+	struct FConnection
+	{
+		FSocket* Socket = nullptr;
+		TArray<uint8> Request;
+		TArray<uint8> Response;
+		int32 BytesSent = 0;
+		double AcceptTime = 0.0;
+	};
+
+	/** Called on the listener thread, the socket is handed over to the game thread. */
 	bool HandleConnectionAccepted(FSocket* ClientSocket, const FIPv4Endpoint& ClientEndpoint);
-	void SendResponse(FSocket* ClientSocket, const FString& Content);
+
+	/** Serves accepted connections. */
+	bool Tick(float DeltaTime);
+
+	/** Reads available request data and prepares the response once headers are received. Returns false if the connection is closed or failed. */
+	bool ReceiveRequest(FConnection& Connection, TArray<FAuthParamsMap>& OutReceivedParams);
+	void HandleRequest(FConnection& Connection, TArray<FAuthParamsMap>& OutReceivedParams);
+
+	/** Sends as much of the response as the socket accepts. Returns false if the connection failed. */
+	bool SendResponse(FConnection& Connection);
+	void FormatResponse(const FString& Content, TArray<uint8>& OutResponse) const;
+
+	void CloseConnection(FConnection& Connection);
 
 	FTcpListener* Listener;
 	FOnAuthParamsReceived OnAuthParamsReceivedDelegate;
@@ -39,6 +69,18 @@ private:
 	FString CachedSuccessMessage;
 	FString CachedErrorTitle;
 	FString CachedErrorMessage;
+
+	/** Sockets accepted by the listener thread and not yet picked up by the game thread. */
+	TQueue<FSocket*, EQueueMode::Mpsc> AcceptedSockets;
+
+	TArray<FConnection> Connections;
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	/** Connections that don't complete the request in time are closed, e.g. speculative connections which are never used. */
+	double ConnectionTimeout = 10.0;
+
+	/** Requests with headers exceeding this size (in bytes) are rejected. */
+	int32 MaxRequestSize = 16 * 1024;
 };
 
 
@@ -8,12 +8,16 @@
 #include "Misc/Base64.h"
 #include "XsollaProjectSettings.h"
 #include "XsollaSettingsModule.h"
+#include "XsollaUtilsSaveWriter.h"
 
 const FString UXsollaLoginSave::SaveSlotName = "XsollaLoginSaveSlot";
 const int32 UXsollaLoginSave::UserIndex = 0;
 
 FXsollaLoginData UXsollaLoginSave::Load()
 {
+	// Pending data is newer than the slot content
+	XsollaUtilsSaveWriter::Get().Flush();
+
 	if (!UGameplayStatics::DoesSaveGameExist(SaveSlotName, UserIndex))
 	{
 		return FXsollaLoginData();
@@ -54,42 +58,41 @@ FXsollaLoginData UXsollaLoginSave::Load()
 
 void UXsollaLoginSave::Save(const FXsollaLoginData& InLoginData)
 {
-	UXsollaLoginSave* SaveInstance = Cast<UXsollaLoginSave>(UGameplayStatics::LoadGameFromSlot(SaveSlotName, UserIndex));
-	if (!SaveInstance)
-	{
-		SaveInstance = Cast<UXsollaLoginSave>(UGameplayStatics::CreateSaveGameObject(StaticClass()));
-	}
-
-	// Encrypt the players sensitive credentials using a secondary AES-256 encryption key configured for the project if enabled
+	// Settings are read on the game thread, encryption is done by the save writer on a worker thread
 	const UXsollaProjectSettings* Settings = FXsollaSettingsModule::Get().GetSettings();
-	FXsollaLoginData CachedLoginData = InLoginData;
+	const bool bEncrypt = Settings->EncryptCachedCredentials;
+	const FAES::FAESKey XsollaSaveEncryptionKey = bEncrypt ? GetEncryptionKey() : FAES::FAESKey();
 
-	if (Settings->EncryptCachedCredentials)
-	{
-		const FAES::FAESKey XsollaSaveEncryptionKey = GetEncryptionKey();
+	const TSharedRef<FXsollaLoginData> CachedLoginData = MakeShared<FXsollaLoginData>(InLoginData);
 
-		if (XsollaSaveEncryptionKey.IsValid())
+	// Save object is created from scratch since login data is the only thing it holds, so the slot isn't read back
+	XsollaUtilsSaveWriter::Get().ScheduleSave(SaveSlotName, UserIndex,
+		[CachedLoginData, bEncrypt, XsollaSaveEncryptionKey]()
 		{
-			const FString KeyStr = FBase64::Encode(XsollaSaveEncryptionKey.Key, XsollaSaveEncryptionKey.KeySize);
-
-			CachedLoginData.AuthToken.JWT = EncryptString(CachedLoginData.AuthToken.JWT, XsollaSaveEncryptionKey);
-			CachedLoginData.Username = EncryptString(CachedLoginData.Username, XsollaSaveEncryptionKey);
-			CachedLoginData.Password = EncryptString(CachedLoginData.Password, XsollaSaveEncryptionKey);
-			CachedLoginData.bEncrypted = true;
-		}
-		else
+			// Encrypt the players sensitive credentials using a secondary AES-256 encryption key configured for the project if enabled
+			if (!bEncrypt)
+			{
+				UE_LOG(LogXsollaLogin, Verbose, TEXT("Xsolla Login Save Encryption is disabled, skipping."));
+				return;
+			}
+
+			if (!XsollaSaveEncryptionKey.IsValid())
+			{
+				UE_LOG(LogXsollaLogin, Error, TEXT("Xsolla Login Save Encryption Key was Invalid!"));
+				return;
+			}
+
+			CachedLoginData->AuthToken.JWT = EncryptString(CachedLoginData->AuthToken.JWT, XsollaSaveEncryptionKey);
+			CachedLoginData->Username = EncryptString(CachedLoginData->Username, XsollaSaveEncryptionKey);
+			CachedLoginData->Password = EncryptString(CachedLoginData->Password, XsollaSaveEncryptionKey);
+			CachedLoginData->bEncrypted = true;
+		},
+		[CachedLoginData]() -> USaveGame*
 		{
-			UE_LOG(LogXsollaLogin, Error, TEXT("Xsolla Login Save Encryption Key was Invalid!"));
-		}
-	}
-	else
-	{
-		UE_LOG(LogXsollaLogin, Verbose, TEXT("Xsolla Login Save Encryption is disabled, skipping."));
-	}
-
-	SaveInstance->LoginData = CachedLoginData;
-
-	UGameplayStatics::SaveGameToSlot(SaveInstance, SaveSlotName, 0);
+			UXsollaLoginSave* SaveInstance = Cast<UXsollaLoginSave>(UGameplayStatics::CreateSaveGameObject(StaticClass()));
+			SaveInstance->LoginData = *CachedLoginData;
+			return SaveInstance;
+		});
 }
 
 FAES::FAESKey UXsollaLoginSave::GetEncryptionKey()
@@ -15,6 +15,7 @@
 #include "Async/Async.h"
 #include "Dom/JsonObject.h"
 #include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
 #include "JsonObjectConverter.h"
 #include "Kismet/GameplayStatics.h"
 #include "OnlineSubsystem.h"
@@ -27,7 +28,9 @@
 #include "XsollaUtilsDataModel.h"
 #include "XsollaLoginBrowserWrapper.h"
 #include "XsollaSocialLinkingBrowserWrapper.h"
+#include "Misc/CoreDelegates.h"
 #include "Misc/EngineVersion.h"
+#include "TimerManager.h"
 #include "Runtime/Launch/Resources/Version.h"
 
 #if PLATFORM_ANDROID
@@ -84,6 +87,10 @@ void UXsollaLoginSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	const UXsollaProjectSettings* Settings = FXsollaSettingsModule::Get().GetSettings();
 	Initialize(Settings->ProjectID, Settings->LoginID, Settings->ClientID);
 
+	FCoreDelegates::ApplicationWillEnterBackgroundDelegate.AddUObject(this, &UXsollaLoginSubsystem::OnAppWillEnterBackground);
+	FCoreDelegates::ApplicationHasEnteredForegroundDelegate.AddUObject(this, &UXsollaLoginSubsystem::OnAppHasEnteredForeground);
+	ScheduleTokenRenewal();
+
 	UE_LOG(LogXsollaLogin, Log, TEXT("%s: XsollaLogin subsystem initialized"), *VA_FUNC_LINE);
 }
 
@@ -94,6 +101,10 @@ void UXsollaLoginSubsystem::Deinitialize()
 		HttpServer->Stop();
 	}
 
+	FCoreDelegates::ApplicationWillEnterBackgroundDelegate.RemoveAll(this);
+	FCoreDelegates::ApplicationHasEnteredForegroundDelegate.RemoveAll(this);
+	GetGameInstance()->GetTimerManager().ClearTimer(TokenRenewalTimerHandle);
+
 	Super::Deinitialize();
 }
 
@@ -188,7 +199,7 @@ void UXsollaLoginSubsystem::RegisterUser(const FString& Username, const FString&
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::RegisterUser_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::ResendAccountConfirmationEmail(const FString& Username, const FString& State, const FString& Locale,
@@ -213,7 +224,7 @@ void UXsollaLoginSubsystem::ResendAccountConfirmationEmail(const FString& Userna
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::Default_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::AuthenticateUser(const FString& Username, const FString& Password,
@@ -252,7 +263,7 @@ void UXsollaLoginSubsystem::AuthenticateUser(const FString& Username, const FStr
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::UserLogin_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::AuthWithXsollaWidget(UObject* WorldContextObject, UXsollaLoginBrowserWrapper*& BrowserWidget,
@@ -440,12 +451,12 @@ void UXsollaLoginSubsystem::ResetUserPassword(const FString& User, const FString
 	const FString Url = XsollaUtilsUrlBuilder(Endpoint)
 							.AddStringQueryParam(TEXT("projectId"), LoginID)
 							.AddStringQueryParam(TEXT("locale"), Locale)
-							.AddStringQueryParam(TEXT("login_url"), FGenericPlatformHttp::UrlEncode(Settings->RedirectURI))
+							.AddStringQueryParam(TEXT("login_url"), Settings->RedirectURI)
 							.Build();
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::Default_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::ValidateToken(const FOnAuthUpdate& SuccessCallback, const FOnAuthError& ErrorCallback)
@@ -453,7 +464,7 @@ void UXsollaLoginSubsystem::ValidateToken(const FOnAuthUpdate& SuccessCallback,
 	// Generate endpoint URL
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(TEXT("https://login.xsolla.com/api/users/me"), EXsollaHttpRequestVerb::VERB_GET, TEXT(""), LoginData.AuthToken.JWT);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::TokenVerify_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::GetSocialAuthenticationUrl(const FString& ProviderName, const FString& State,
@@ -475,7 +486,7 @@ void UXsollaLoginSubsystem::GetSocialAuthenticationUrl(const FString& ProviderNa
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::SocialAuthUrl_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::LaunchSocialAuthentication(UObject* WorldContextObject, UUserWidget*& BrowserWidget, const bool bRememberMe)
@@ -661,7 +672,7 @@ void UXsollaLoginSubsystem::AuthenticateViaSocialNetwork(const FString& Provider
 				}
 				HandleRequestOAuthError(OutError, ErrorCallback);
 			});
-			HttpRequest->ProcessRequest();
+			XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 		}
 		else
 		{
@@ -704,7 +715,7 @@ void UXsollaLoginSubsystem::RefreshToken(const FString& RefreshToken, const FOnA
 	HttpRequest->SetContentAsString(UXsollaUtilsLibrary::EncodeFormData(RequestDataJson));
 	XsollaUtilsLoggingHelper::LogHttpRequest(HttpRequest, PostContent);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::RefreshToken_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::ExchangeAuthenticationCodeToToken(const FString& AuthenticationCode, const FOnAuthUpdate& SuccessCallback, const FOnAuthError& ErrorCallback)
@@ -747,7 +758,7 @@ void UXsollaLoginSubsystem::ExchangeAuthenticationCodeToToken(const FString& Aut
 	HttpRequest->SetContentAsString(UXsollaUtilsLibrary::EncodeFormData(RequestDataJson));
 	XsollaUtilsLoggingHelper::LogHttpRequest(HttpRequest, PostContent);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::RefreshToken_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::AuthenticateWithSessionTicket(const FString& ProviderName, const FString& SessionTicket, const FString& Code,
@@ -791,7 +802,7 @@ void UXsollaLoginSubsystem::AuthenticateWithSessionTicket(const FString& Provide
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::SessionTicket_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::GetUserAttributes(const FString& AuthToken, const FString& UserId, const TArray<FString>& AttributeKeys,
@@ -825,7 +836,7 @@ void UXsollaLoginSubsystem::GetUserAttributes(const FString& AuthToken, const FS
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::GetUserAttributes_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -862,7 +873,7 @@ void UXsollaLoginSubsystem::GetUserReadOnlyAttributes(const FString& AuthToken,
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::GetReadOnlyUserAttributes_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -899,7 +910,7 @@ void UXsollaLoginSubsystem::ModifyUserAttributes(const FString& AuthToken, const
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::DefaultWithHandlerWrapper_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -925,7 +936,7 @@ void UXsollaLoginSubsystem::RemoveUserAttributes(const FString& AuthToken, const
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::DefaultWithHandlerWrapper_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -939,7 +950,7 @@ void UXsollaLoginSubsystem::CreateAccountLinkingCode(const FString& AuthToken, c
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(TEXT("https://login.xsolla.com/api/users/account/code"), EXsollaHttpRequestVerb::VERB_POST, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::AccountLinkingCode_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest(); });
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest); });
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
 }
@@ -960,7 +971,7 @@ void UXsollaLoginSubsystem::CheckUserAge(const FString& DateOfBirth, const FOnCh
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::CheckUserAge_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::LinkEmailAndPassword(const FString& AuthToken, const FString& Email, const FString& Password, const bool ReceiveNewsConsent, const FString& Username,
@@ -980,7 +991,7 @@ void UXsollaLoginSubsystem::LinkEmailAndPassword(const FString& AuthToken, const
 	// Generate endpoint URL
 	const UXsollaProjectSettings* Settings = FXsollaSettingsModule::Get().GetSettings();
 	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://login.xsolla.com/api/users/me/link_email_password"))
-							.AddStringQueryParam(TEXT("login_url"), FGenericPlatformHttp::UrlEncode(Settings->RedirectURI))
+							.AddStringQueryParam(TEXT("login_url"), Settings->RedirectURI)
 							.Build();
 
 	FOnTokenUpdate SuccessTokenUpdate;
@@ -989,7 +1000,7 @@ void UXsollaLoginSubsystem::LinkEmailAndPassword(const FString& AuthToken, const
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::LinkEmailAndPassword_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1018,7 +1029,7 @@ void UXsollaLoginSubsystem::LinkDeviceToAccount(const FString& AuthToken, const
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::DefaultWithHandlerWrapper_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1037,7 +1048,7 @@ void UXsollaLoginSubsystem::UnlinkDeviceFromAccount(const FString& AuthToken, co
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_DELETE, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::DefaultWithHandlerWrapper_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1077,7 +1088,7 @@ void UXsollaLoginSubsystem::AuthenticateViaDeviceId(const FString& DeviceName, c
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::DeviceId_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::AuthViaAccessTokenOfSocialNetwork(
@@ -1115,7 +1126,7 @@ void UXsollaLoginSubsystem::AuthViaAccessTokenOfSocialNetwork(
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::AuthViaAccessTokenOfSocialNetwork_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::StartAuthByPhoneNumber(const FString& PhoneNumber, const FString& State,
@@ -1148,7 +1159,7 @@ void UXsollaLoginSubsystem::StartAuthByPhoneNumber(const FString& PhoneNumber, c
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::StartAuth_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::CompleteAuthByPhoneNumber(const FString& Code, const FString& OperationId, const FString& PhoneNumber,
@@ -1171,7 +1182,7 @@ void UXsollaLoginSubsystem::CompleteAuthByPhoneNumber(const FString& Code, const
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::CompleteAuthByPhoneNumber_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::StartAuthByEmail(const FString& Email, const FString& State,
@@ -1204,7 +1215,7 @@ void UXsollaLoginSubsystem::StartAuthByEmail(const FString& Email, const FString
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::StartAuth_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::CompleteAuthByEmail(const FString& Code, const FString& OperationId, const FString& Email,
@@ -1227,7 +1238,7 @@ void UXsollaLoginSubsystem::CompleteAuthByEmail(const FString& Code, const FStri
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::CompleteAuthByEmail_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::GetAuthConfirmationCode(const FString& UserId, const FString& OperationId,
@@ -1236,13 +1247,13 @@ void UXsollaLoginSubsystem::GetAuthConfirmationCode(const FString& UserId, const
 	// Generate endpoint URL
 	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://login.xsolla.com/api/otc/code"))
 							.AddStringQueryParam(TEXT("projectId"), LoginID)
-							.AddStringQueryParam(TEXT("login"), FGenericPlatformHttp::UrlEncode(UserId))
+							.AddStringQueryParam(TEXT("login"), UserId)
 							.AddStringQueryParam(TEXT("operation_id"), OperationId)
 							.Build();
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::GetAuthConfirmationCode_HttpRequestComplete, SuccessCallback, TimeoutCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::GetUserDetails(const FString& AuthToken, const FOnUserDetailsUpdate& SuccessCallback, const FOnError& ErrorCallback)
@@ -1254,7 +1265,7 @@ void UXsollaLoginSubsystem::GetUserDetails(const FString& AuthToken, const FOnUs
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::UserDetails_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1285,7 +1296,7 @@ void UXsollaLoginSubsystem::ModifyUserDetails(const FString& AuthToken, const FS
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(TEXT("https://login.xsolla.com/api/users/me"), EXsollaHttpRequestVerb::VERB_PATCH, PostContent, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::UserDetails_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1301,7 +1312,7 @@ void UXsollaLoginSubsystem::GetUserEmail(const FString& AuthToken, const FOnUser
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::UserEmail_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1318,7 +1329,7 @@ void UXsollaLoginSubsystem::GetUserPhoneNumber(const FString& AuthToken, const F
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::UserPhoneNumber_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1344,7 +1355,7 @@ void UXsollaLoginSubsystem::ModifyUserPhoneNumber(const FString& AuthToken, cons
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::ModifyPhoneNumber_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1364,7 +1375,7 @@ void UXsollaLoginSubsystem::RemoveUserPhoneNumber(const FString& AuthToken, cons
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_DELETE, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::RemovePhoneNumber_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1406,7 +1417,7 @@ void UXsollaLoginSubsystem::ModifyUserProfilePicture(const FString& AuthToken, U
 		HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("multipart/form-data; boundary =" + Boundary));
 		HttpRequest->SetContent(UploadContent);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::UserProfilePicture_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1422,7 +1433,7 @@ void UXsollaLoginSubsystem::RemoveProfilePicture(const FString& AuthToken, const
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_DELETE, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::UserProfilePictureRemove_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1450,7 +1461,7 @@ void UXsollaLoginSubsystem::GetFriends(const FString& AuthToken, const EXsollaFr
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::UserFriends_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1476,7 +1487,7 @@ void UXsollaLoginSubsystem::ModifyFriends(const FString& AuthToken, const EXsoll
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, PostContent, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::DefaultWithHandlerWrapper_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1494,7 +1505,7 @@ void UXsollaLoginSubsystem::GetSocialAuthLinks(const FString& AuthToken, const F
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::SocialAuthLinks_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1517,7 +1528,7 @@ void UXsollaLoginSubsystem::GetSocialFriends(const FString& AuthToken, const FSt
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::SocialFriends_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1535,7 +1546,7 @@ void UXsollaLoginSubsystem::GetUsersFriends(const FString& AuthToken, const FStr
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::GetUsersFriends_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1553,7 +1564,7 @@ void UXsollaLoginSubsystem::GetUserProfile(const FString& AuthToken, const FStri
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::UserProfile_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1569,7 +1580,7 @@ void UXsollaLoginSubsystem::GetUsersDevices(const FString& AuthToken, const FOnU
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::GetUsersDevices_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1580,7 +1591,7 @@ void UXsollaLoginSubsystem::SearchUsersByNickname(const FString& AuthToken, cons
 {
 	// Generate endpoint URL
 	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://login.xsolla.com/api/users/search/by_nickname"))
-							.AddStringQueryParam(TEXT("nickname"), FGenericPlatformHttp::UrlEncode(Nickname))
+							.AddStringQueryParam(TEXT("nickname"), Nickname)
 							.AddNumberQueryParam(TEXT("limit"), Limit)
 							.AddNumberQueryParam(TEXT("offset"), Offset)
 							.Build();
@@ -1590,7 +1601,7 @@ void UXsollaLoginSubsystem::SearchUsersByNickname(const FString& AuthToken, cons
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::UserSearch_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1604,7 +1615,7 @@ void UXsollaLoginSubsystem::GetUrlToLinkSocialNetworkToUserAccount(const FString
 
 	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://login.xsolla.com/api/users/me/social_providers/{ProviderName}/login_url"))
 							.SetPathParam(TEXT("ProviderName"), ProviderName)
-							.AddStringQueryParam(TEXT("login_url"), FGenericPlatformHttp::UrlEncode(Settings->RedirectURI))
+							.AddStringQueryParam(TEXT("login_url"), Settings->RedirectURI)
 							.Build();
 
 	FOnTokenUpdate SuccessTokenUpdate;
@@ -1613,7 +1624,7 @@ void UXsollaLoginSubsystem::GetUrlToLinkSocialNetworkToUserAccount(const FString
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::SocialAccountLinking_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1657,7 +1668,7 @@ void UXsollaLoginSubsystem::UnlinkSocialProvider(const FString& AuthToken, const
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_DELETE, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::DefaultWithHandlerWrapper_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest(); });
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest); });
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
 }
@@ -1672,7 +1683,7 @@ void UXsollaLoginSubsystem::GetLinkedSocialNetworks(const FString& AuthToken, co
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::LinkedSocialNetworks_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1693,7 +1704,7 @@ void UXsollaLoginSubsystem::LogoutUser(const FString& AuthToken, const EXsollaSe
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, TEXT(""), Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::LogoutUser_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -2724,7 +2735,9 @@ TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UXsollaLoginSubsystem::CreateHttpR
 	UE_LOG(LogXsollaLogin, Log, TEXT("%s: Creating HTTP request - URL: %s, Verb: %s"),
 		*VA_FUNC_LINE, *Url, *XsollaUtilsLoggingHelper::VerbToString(Verb));
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = XsollaUtilsHttpRequestHelper::CreateHttpRequest(Url, Verb, AuthToken, Content, TEXT("LOGIN"), XSOLLA_LOGIN_VERSION);
+	static const FString SdkModuleName(TEXT("LOGIN"));
+	static const FString SdkModuleVersion(XSOLLA_LOGIN_VERSION);
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = XsollaUtilsHttpRequestHelper::CreateHttpRequest(Url, Verb, AuthToken, Content, SdkModuleName, SdkModuleVersion);
 	if (!skipLogging)
 	{
 		XsollaUtilsLoggingHelper::LogHttpRequest(HttpRequest, Content);
@@ -2759,6 +2772,8 @@ void UXsollaLoginSubsystem::SetLoginData(const FXsollaLoginData& Data, const boo
 		// Erase saved data in cache
 		UXsollaLoginSave::Save(LoginData);
 	}
+
+	ScheduleTokenRenewal();
 }
 
 void UXsollaLoginSubsystem::UpdateAuthTokenData(const FString& AccessToken, int ExpiresIn, const FString& RefreshToken, bool bRememberMe)
@@ -2773,12 +2788,15 @@ void UXsollaLoginSubsystem::DropLoginData(const bool ClearCache)
 {
 	// Erase saved data in memory
 	LoginData = FXsollaLoginData();
+	UXsollaUtilsTokenParser::ClearTokenCache();
 
 	if (ClearCache)
 	{
 		// Erase saved data in cache
 		UXsollaLoginSave::Save(LoginData);
 	}
+
+	ScheduleTokenRenewal();
 }
 
 void UXsollaLoginSubsystem::LoadSavedData()
@@ -2797,6 +2815,9 @@ void UXsollaLoginSubsystem::SaveData()
 		// Don't drop cache in memory but reset save file
 		UXsollaLoginSave::Save(FXsollaLoginData());
 	}
+
+	// Login data is saved whenever the token changes
+	ScheduleTokenRenewal();
 }
 
 void UXsollaLoginSubsystem::InnerRefreshToken(const FString& RefreshToken, const FOnLoginDataUpdate& SuccessCallback, const FOnLoginDataError& ErrorCallback)
@@ -2823,33 +2844,40 @@ void UXsollaLoginSubsystem::InnerRefreshToken(const FString& RefreshToken, const
 	HttpRequest->SetContentAsString(UXsollaUtilsLibrary::EncodeFormData(RequestDataJson));
 	XsollaUtilsLoggingHelper::LogHttpRequest(HttpRequest, PostContent);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaLoginSubsystem::InnerRefreshToken_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaLoginSubsystem::HandleRequestError(const XsollaHttpRequestError& ErrorData, FErrorHandlersWrapper ErrorHandlersWrapper)
 {
 	if (ErrorData.statusCode == 401 || ErrorData.statusCode == 403) // token time expired
 	{
+		if (ErrorHandlersWrapper.bNeedRepeatRequest && !bIsRefreshingToken
+			&& FPlatformTime::Seconds() - LastTokenRefreshTime < TokenRefreshReuseWindow)
+		{
+			UE_LOG(LogXsollaLogin, Log, TEXT("%s: Token was refreshed recently. Repeating original request with new token."), *VA_FUNC_LINE);
+			ErrorHandlersWrapper.TokenUpdateCallback.ExecuteIfBound(LoginData.AuthToken.JWT, false);
+			return;
+		}
+
+		// All requests failed with the expired token share one refresh, as the refresh token may be rotated by it
+		PendingTokenRefreshHandlers.Add(ErrorHandlersWrapper);
+		if (bIsRefreshingToken)
+		{
+			UE_LOG(LogXsollaLogin, Log, TEXT("%s: Token refresh is in progress, request will be repeated after it (Status code: %d)."),
+				*VA_FUNC_LINE, ErrorData.statusCode);
+			return;
+		}
+
 		UE_LOG(LogXsollaLogin, Warning, TEXT("%s: Authentication token expired or invalid (Status code: %d). Attempting to refresh token."),
 			*VA_FUNC_LINE, ErrorData.statusCode);
 
+		bIsRefreshingToken = true;
+
 		FOnLoginDataUpdate SuccessRefreshCallback;
-		SuccessRefreshCallback.BindLambda([ErrorHandlersWrapper](const FXsollaLoginData& InLoginData)
-		{
-			if (ErrorHandlersWrapper.bNeedRepeatRequest)
-			{
-				UE_LOG(LogXsollaLogin, Log, TEXT("Token refresh successful. Repeating original request with new token."));
-				ErrorHandlersWrapper.TokenUpdateCallback.ExecuteIfBound(InLoginData.AuthToken.JWT, false);
-			}
-		});
+		SuccessRefreshCallback.BindUObject(this, &UXsollaLoginSubsystem::OnTokenRefreshed);
 
 		FOnLoginDataError ErrorRefreshCallback;
-		ErrorRefreshCallback.BindLambda([ErrorHandlersWrapper](int32 StatusCode, int32 ErrorCode, const FString& Description)
-		{
-			UE_LOG(LogXsollaLogin, Error, TEXT("Token refresh failed - Status code: %d, Error code: %d, Description: %s"),
-				StatusCode, ErrorCode, *Description);
-			ErrorHandlersWrapper.ErrorCallback.ExecuteIfBound(StatusCode, ErrorCode, Description);
-		});
+		ErrorRefreshCallback.BindUObject(this, &UXsollaLoginSubsystem::OnTokenRefreshFailed);
 
 		InnerRefreshToken(LoginData.AuthToken.RefreshToken, SuccessRefreshCallback, ErrorRefreshCallback);
 	}
@@ -2862,6 +2890,96 @@ void UXsollaLoginSubsystem::HandleRequestError(const XsollaHttpRequestError& Err
 	}
 }
 
+void UXsollaLoginSubsystem::OnTokenRefreshed(const FXsollaLoginData& InLoginData)
+{
+	bIsRefreshingToken = false;
+	LastTokenRefreshTime = FPlatformTime::Seconds();
+
+	// Repeated requests may fail again and queue new handlers
+	const TArray<FErrorHandlersWrapper> Handlers = MoveTemp(PendingTokenRefreshHandlers);
+	PendingTokenRefreshHandlers.Reset();
+
+	UE_LOG(LogXsollaLogin, Log, TEXT("%s: Token refresh successful. Repeating %d requests with new token."), *VA_FUNC_LINE, Handlers.Num());
+
+	for (const FErrorHandlersWrapper& Handler : Handlers)
+	{
+		if (Handler.bNeedRepeatRequest)
+		{
+			Handler.TokenUpdateCallback.ExecuteIfBound(InLoginData.AuthToken.JWT, false);
+		}
+	}
+}
+
+void UXsollaLoginSubsystem::OnTokenRefreshFailed(int32 StatusCode, int32 ErrorCode, const FString& Description)
+{
+	bIsRefreshingToken = false;
+
+	const TArray<FErrorHandlersWrapper> Handlers = MoveTemp(PendingTokenRefreshHandlers);
+	PendingTokenRefreshHandlers.Reset();
+
+	UE_LOG(LogXsollaLogin, Error, TEXT("%s: Token refresh failed - Status code: %d, Error code: %d, Description: %s"),
+		*VA_FUNC_LINE, StatusCode, ErrorCode, *Description);
+
+	for (const FErrorHandlersWrapper& Handler : Handlers)
+	{
+		Handler.ErrorCallback.ExecuteIfBound(StatusCode, ErrorCode, Description);
+	}
+}
+
+void UXsollaLoginSubsystem::ScheduleTokenRenewal()
+{
+	FTimerManager& TimerManager = GetGameInstance()->GetTimerManager();
+	TimerManager.ClearTimer(TokenRenewalTimerHandle);
+
+	const float Margin = FXsollaSettingsModule::Get().GetSettings()->TokenRenewalMargin;
+	if (Margin <= 0.f || bIsInBackground || LoginData.AuthToken.ExpiresAt <= 0 || LoginData.AuthToken.RefreshToken.IsEmpty())
+	{
+		return;
+	}
+
+	// Jitter spreads renewals of clients that got tokens at the same time
+	const float JitteredMargin = Margin * FMath::FRandRange(1.f, 1.2f);
+	const double Delay = static_cast<double>(LoginData.AuthToken.ExpiresAt - FDateTime::UtcNow().ToUnixTimestamp()) - JitteredMargin;
+
+	// Timer with zero delay is cleared instead of being set, so the renewal is made on the next frame
+	const float RenewalDelay = FMath::Max(static_cast<float>(Delay), KINDA_SMALL_NUMBER);
+	UE_LOG(LogXsollaLogin, Verbose, TEXT("%s: Token renewal is scheduled in %.0f s"), *VA_FUNC_LINE, RenewalDelay);
+	TimerManager.SetTimer(TokenRenewalTimerHandle, this, &UXsollaLoginSubsystem::RenewToken, RenewalDelay, false);
+}
+
+void UXsollaLoginSubsystem::RenewToken()
+{
+	// Renewal shares the refresh with requests failed because of expired token
+	if (bIsRefreshingToken)
+	{
+		return;
+	}
+
+	UE_LOG(LogXsollaLogin, Log, TEXT("%s: Renewing token before expiration"), *VA_FUNC_LINE);
+	bIsRefreshingToken = true;
+
+	FOnLoginDataUpdate SuccessRefreshCallback;
+	SuccessRefreshCallback.BindUObject(this, &UXsollaLoginSubsystem::OnTokenRefreshed);
+
+	FOnLoginDataError ErrorRefreshCallback;
+	ErrorRefreshCallback.BindUObject(this, &UXsollaLoginSubsystem::OnTokenRefreshFailed);
+
+	InnerRefreshToken(LoginData.AuthToken.RefreshToken, SuccessRefreshCallback, ErrorRefreshCallback);
+}
+
+void UXsollaLoginSubsystem::OnAppWillEnterBackground()
+{
+	bIsInBackground = true;
+	GetGameInstance()->GetTimerManager().ClearTimer(TokenRenewalTimerHandle);
+}
+
+void UXsollaLoginSubsystem::OnAppHasEnteredForeground()
+{
+	// Token may expire while the app is in background, in this case it's renewed right away
+	bIsInBackground = false;
+	ScheduleTokenRenewal();
+}
+
 void UXsollaLoginSubsystem::SocialAuthUrlReceivedCallback(const FString& Url)
 {
 	XsollaUtilsLoggingHelper::LogUrl(Url, TEXT("Social authentication URL received"));
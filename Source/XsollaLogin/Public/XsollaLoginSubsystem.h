@@ -8,6 +8,7 @@
 #include "XsollaUtilsHttpRequestHelper.h"
 
 #include "Blueprint/UserWidget.h"
+#include "Engine/EngineTypes.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Subsystems/SubsystemCollection.h"
 #include "XsollaUtilsDataModel.h"
@@ -845,7 +846,33 @@ public:
 	/** Saves cached data or resets it if RememberMe is false. */
 	void SaveData();
 
+	/** Handles request error. Requests failed because of expired token wait for a single token refresh and are repeated after it. */
 	void HandleRequestError(const XsollaHttpRequestError& ErrorData, FErrorHandlersWrapper ErrorHandlersWrapper);
+
+private:
+	void OnTokenRefreshed(const FXsollaLoginData& InLoginData);
+	void OnTokenRefreshFailed(int32 StatusCode, int32 ErrorCode, const FString& Description);
+
+	/** Schedules token renewal before the token expires. Renewal is paused while the app is in background. */
+	void ScheduleTokenRenewal();
+	void RenewToken();
+
+	void OnAppWillEnterBackground();
+	void OnAppHasEnteredForeground();
+
+	FTimerHandle TokenRenewalTimerHandle;
+	bool bIsInBackground = false;
+
+	/** Whether token refresh triggered by request errors is in progress. */
+	bool bIsRefreshingToken = false;
+
+	/** Handlers of requests waiting for token refresh. */
+	TArray<FErrorHandlersWrapper> PendingTokenRefreshHandlers;
+
+	/** Requests failed within this time after token refresh were sent with the old token, so they are repeated without another refresh. */
+	double TokenRefreshReuseWindow = 5.0;
+	double LastTokenRefreshTime = -TNumericLimits<double>::Max();
+
 protected:
 	/** Keeps state of user login. */
 	FXsollaLoginData LoginData;
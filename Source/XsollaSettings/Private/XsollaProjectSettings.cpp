@@ -23,4 +23,10 @@ UXsollaProjectSettings::UXsollaProjectSettings(const FObjectInitializer& ObjectI
 	RedirectDelay = 0;
 	RedirectStatusManual = EXsollaPaymentRedirectStatusManual::none;
 	RedirectButtonCaption = TEXT("");
+	CacheCatalogResponses = false;
+	MaxCatalogPagesInFlight = 4;
+	RequestCoalescingWindow = 0.f;
+	UseCentrifugoProtobuf = false;
+	KeepCentrifugoConnection = false;
+	TokenRenewalMargin = 60.f;
 }
@@ -157,4 +157,44 @@ public:
 	/** Enable to process payment tasks via Steam. */
 	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "General")
 	bool BuildForSteam;
+
+	/**
+	 * Enable to keep catalog responses (virtual items, currencies, bundles, item groups) on disk.
+	 * Subsequent requests are sent with `If-None-Match` and unchanged catalog pages are not downloaded again.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Catalog")
+	bool CacheCatalogResponses;
+
+	/** Maximum number of catalog pages requested in parallel when the complete catalog is loaded (e.g. with GetVirtualItems). */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Catalog", meta = (ClampMin = "1", ClampMax = "16"))
+	int32 MaxCatalogPagesInFlight;
+
+	/**
+	 * Time in seconds during which a successful GET response is reused for identical requests (same URL and user).
+	 * Identical requests in flight always share one response. Set to 0 to only share responses of requests in flight.
+	 * Order status checks are never answered with a reused response.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0", ClampMax = "10"))
+	float RequestCoalescingWindow;
+
+	/**
+	 * If enabled, order status updates are received over Centrifugo protobuf protocol, which is more compact than JSON.
+	 * Falls back to JSON protocol if the server doesn't accept protobuf connection.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Network")
+	bool UseCentrifugoProtobuf;
+
+	/**
+	 * If enabled, Centrifugo connection used for order status updates is kept open for the whole session and reused
+	 * for all purchases instead of being closed when no orders are tracked. Use PreconnectOrderTracking to open it in advance.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Network")
+	bool KeepCentrifugoConnection;
+
+	/**
+	 * Time in seconds before user token expiration when the token is renewed in background, so that requests don't fail with expired token.
+	 * Set to 0 to refresh the token only after a request fails.
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Network", meta = (ClampMin = "0", ClampMax = "3600"))
+	float TokenRenewalMargin;
 };
@@ -3,13 +3,19 @@
 #include "CentrifugoClient.h"
 #include "WebSocketsModule.h"
 #include "XsollaStoreDefines.h"
-#include "Dom/JsonObject.h"
-#include "JsonObjectConverter.h"
-#include "Serialization/JsonSerializer.h"
-#include "Serialization/JsonWriter.h"
 
-FString UCentrifugoClient::PingMessage = TEXT("{}");
-FString UCentrifugoClient::PongMessage = TEXT("{}");
+namespace
+{
+	/** Server pings and client pongs are empty JSON objects. */
+	const ANSICHAR PingMessage[] = "{}";
+	const ANSICHAR PongMessage[] = "{}";
+	constexpr SIZE_T PingMessageSize = sizeof(PingMessage) - 1;
+	constexpr SIZE_T PongMessageSize = sizeof(PongMessage) - 1;
+
+	/** In protobuf protocol they are empty length-delimited messages. */
+	const uint8 ProtobufPingMessage[] = {0};
+	const uint8 ProtobufPongMessage[] = {0};
+}
 
 UCentrifugoClient::UCentrifugoClient(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -17,11 +23,18 @@ UCentrifugoClient::UCentrifugoClient(const FObjectInitializer& ObjectInitializer
 	
 }
 
-void UCentrifugoClient::Connect()
+void UCentrifugoClient::Connect(const bool bInUseProtobuf)
 {
-	WebSocket = FWebSocketsModule::Get().CreateWebSocket(TEXT("wss://ws-store.xsolla.com/connection/websocket"), TEXT("wss"));
+	bUseProtobuf = bInUseProtobuf;
+	LastMessageTime = FPlatformTime::Seconds();
+
+	const TCHAR* Url = bUseProtobuf
+		? TEXT("wss://ws-store.xsolla.com/connection/websocket?format=protobuf")
+		: TEXT("wss://ws-store.xsolla.com/connection/websocket");
+	WebSocket = FWebSocketsModule::Get().CreateWebSocket(Url, TEXT("wss"));
 	WebSocket->OnConnected().AddUObject(this, &UCentrifugoClient::OnSocketConnected);
-	WebSocket->OnMessage().AddUObject(this, &UCentrifugoClient::OnSocketMessage);
+	// Only raw messages are handled, so text frames aren't converted to FString
+	WebSocket->OnRawMessage().AddUObject(this, &UCentrifugoClient::OnSocketRawMessage);
 	WebSocket->OnConnectionError().AddUObject(this, &UCentrifugoClient::OnSocketConnectionError);
 	WebSocket->OnClosed().AddUObject(this, &UCentrifugoClient::OnSocketClosed);
 	WebSocket->Connect();
@@ -30,28 +43,37 @@ void UCentrifugoClient::Connect()
 void UCentrifugoClient::Disconnect()
 {
 	WebSocket->OnConnected().RemoveAll(this);
-	WebSocket->OnMessage().RemoveAll(this);
+	WebSocket->OnRawMessage().RemoveAll(this);
 	WebSocket->OnConnectionError().RemoveAll(this);
 	WebSocket->OnClosed().RemoveAll(this);
 	WebSocket->Close();
 	WebSocket = nullptr;
+	PendingMessage.Empty();
 }
 
 void UCentrifugoClient::Send(const FString& Data)
 {
-	FString CleanData = Data;
-	CleanData = CleanData.Replace(TEXT("\n"), TEXT(""));
-	CleanData = CleanData.Replace(TEXT("\r"), TEXT(""));
-	CleanData.RemoveSpacesInline();
+	UE_LOG(LogXsollaCentrifugo, Log, TEXT("Centrifugo. Websocket send data: %s"), *Data);
+	WebSocket->Send(Data);
+}
 
-	UE_LOG(LogXsollaCentrifugo, Log, TEXT("Centrifugo. Websocket send data: %s"), *CleanData);
-	WebSocket->Send(CleanData);
+void UCentrifugoClient::Send(TConstArrayView<uint8> Data)
+{
+	UE_LOG(LogXsollaCentrifugo, Log, TEXT("Centrifugo. Websocket send %d bytes."), Data.Num());
+	WebSocket->Send(Data.GetData(), Data.Num(), true);
 }
 
 void UCentrifugoClient::SendPing()
 {
 	UE_LOG(LogXsollaCentrifugo, Log, TEXT("Centrifugo. Websocket send ping."));
-	WebSocket->Send(PingMessage);
+	if (bUseProtobuf)
+	{
+		WebSocket->Send(ProtobufPongMessage, sizeof(ProtobufPongMessage), true);
+	}
+	else
+	{
+		WebSocket->Send(PingMessage, PingMessageSize, false);
+	}
 }
 
 bool UCentrifugoClient::IsAlive()
@@ -59,22 +81,69 @@ bool UCentrifugoClient::IsAlive()
 	return WebSocket->IsConnected();
 }
 
+bool UCentrifugoClient::IsUsingProtobuf() const
+{
+	return bUseProtobuf;
+}
+
+double UCentrifugoClient::GetLastMessageTime() const
+{
+	return LastMessageTime;
+}
+
 void UCentrifugoClient::OnSocketConnected()
 {
 	UE_LOG(LogXsollaCentrifugo, Log, TEXT("Centrifugo. Connected to the websocket server."));
 	Opened.ExecuteIfBound();
 }
 
-void UCentrifugoClient::OnSocketMessage(const FString& Message)
+void UCentrifugoClient::OnSocketRawMessage(const void* Data, SIZE_T Size, SIZE_T BytesRemaining)
 {
-	if (Message == PingMessage)
+	LastMessageTime = FPlatformTime::Seconds();
+
+	const uint8* Bytes = static_cast<const uint8*>(Data);
+
+	// Whole frames are passed on without copying, fragmented ones are collected first
+	if (BytesRemaining == 0 && PendingMessage.Num() == 0)
+	{
+		ProcessMessage(MakeArrayView(Bytes, static_cast<int32>(Size)));
+		return;
+	}
+
+	PendingMessage.Append(Bytes, static_cast<int32>(Size));
+	if (BytesRemaining == 0)
+	{
+		const TArray<uint8> Message = MoveTemp(PendingMessage);
+		PendingMessage.Reset();
+		ProcessMessage(Message);
+	}
+}
+
+void UCentrifugoClient::ProcessMessage(TConstArrayView<uint8> Message)
+{
+	if (bUseProtobuf)
+	{
+		if (Message.Num() == sizeof(ProtobufPingMessage) && FMemory::Memcmp(Message.GetData(), ProtobufPingMessage, sizeof(ProtobufPingMessage)) == 0)
+		{
+			UE_LOG(LogXsollaCentrifugo, Verbose, TEXT("Centrifugo. Websocket handshake."));
+			WebSocket->Send(ProtobufPongMessage, sizeof(ProtobufPongMessage), true);
+			return;
+		}
+
+		UE_LOG(LogXsollaCentrifugo, Log, TEXT("Centrifugo. Received %d bytes from the websocket server."), Message.Num());
+		MessageReceived.ExecuteIfBound(Message);
+		return;
+	}
+
+	if (Message.Num() == PingMessageSize && FMemory::Memcmp(Message.GetData(), PingMessage, PingMessageSize) == 0)
 	{
-		UE_LOG(LogXsollaCentrifugo, Log, TEXT("Centrifugo. Websocket handshake."));
-		WebSocket->Send(PongMessage);
+		UE_LOG(LogXsollaCentrifugo, Verbose, TEXT("Centrifugo. Websocket handshake."));
+		WebSocket->Send(PongMessage, PongMessageSize, false);
 		return;
 	}
 
-	UE_LOG(LogXsollaCentrifugo, Log, TEXT("Centrifugo. Received message from the websocket server: \"%s\"."), *Message);
+	UE_LOG(LogXsollaCentrifugo, Log, TEXT("Centrifugo. Received message from the websocket server: \"%s\"."),
+		*FString(Message.Num(), reinterpret_cast<const UTF8CHAR*>(Message.GetData())));
 	MessageReceived.ExecuteIfBound(Message);
 }
 
@@ -6,7 +6,8 @@
 #include "IWebSocket.h"
 #include "CentrifugoClient.generated.h"
 
-DECLARE_DELEGATE_OneParam(FOnCentrifugoMessageReceived, const FString&);
+/** Message is a view of the received UTF-8 frame, valid only during the call. */
+DECLARE_DELEGATE_OneParam(FOnCentrifugoMessageReceived, TConstArrayView<uint8>);
 DECLARE_DELEGATE_OneParam(FOnCentrifugoError, const FString&);
 DECLARE_DELEGATE_OneParam(FOnCentrifugoClosed, const FString&);
 
@@ -21,19 +22,33 @@ public:
 	FOnCentrifugoError Error;
 	FOnCentrifugoClosed Closed;
 
-	void Connect();
+	/** Connects using protobuf or JSON protocol. */
+	void Connect(const bool bInUseProtobuf);
 	void Disconnect();
+	/** Sends message as is, it must be serialized compactly. */
 	void Send(const FString& Data);
+	/** Sends binary frame, used with protobuf protocol. */
+	void Send(TConstArrayView<uint8> Data);
 	void SendPing();
 	bool IsAlive();
+	bool IsUsingProtobuf() const;
+
+	/** Time of the last received message, including pings, or of connection start. */
+	double GetLastMessageTime() const;
 
 private:
 	TSharedPtr<IWebSocket> WebSocket;
-	static FString PingMessage;
-	static FString PongMessage;
+
+	bool bUseProtobuf = false;
+
+	double LastMessageTime = 0.0;
+
+	/** Fragments of the message being received. */
+	TArray<uint8> PendingMessage;
 
 	void OnSocketConnected();
-	void OnSocketMessage(const FString& Message);
+	void OnSocketRawMessage(const void* Data, SIZE_T Size, SIZE_T BytesRemaining);
+	void ProcessMessage(TConstArrayView<uint8> Message);
 	void OnSocketConnectionError(const FString& ErrorMessage);
 	void OnSocketClosed(int32 StatusCode, const FString& Reason, bool bWasClean);
 };
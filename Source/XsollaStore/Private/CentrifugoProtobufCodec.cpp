@@ -0,0 +1,346 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#include "CentrifugoProtobufCodec.h"
+#include "XsollaStoreDefines.h"
+#include "XsollaUtilsJsonStructReader.h"
+
+namespace
+{
+	enum EWireType : uint32
+	{
+		Varint = 0,
+		Fixed64 = 1,
+		LengthDelimited = 2,
+		Fixed32 = 5
+	};
+
+	// Field numbers from Centrifugo client protocol definitions
+	constexpr uint32 CommandIdField = 1;
+	constexpr uint32 CommandConnectField = 4;
+	constexpr uint32 ConnectRequestDataField = 2;
+
+	constexpr uint32 ReplyIdField = 1;
+	constexpr uint32 ReplyErrorField = 2;
+	constexpr uint32 ReplyPushField = 4;
+	constexpr uint32 ReplyConnectField = 5;
+
+	constexpr uint32 ConnectResultPingField = 7;
+
+	constexpr uint32 ErrorCodeField = 1;
+	constexpr uint32 ErrorMessageField = 2;
+
+	constexpr uint32 PushChannelField = 2;
+	constexpr uint32 PushPubField = 4;
+
+	constexpr uint32 PublicationDataField = 4;
+	constexpr uint32 PublicationOffsetField = 6;
+}
+
+void CentrifugoProtobufCodec::EncodeConnectCommand(const uint32 Id, const FString& Data, TArray<uint8>& OutFrame)
+{
+	const FTCHARToUTF8 Utf8Data(*Data);
+
+	TArray<uint8> ConnectRequest;
+	WriteBytes(ConnectRequestDataField, reinterpret_cast<const uint8*>(Utf8Data.Get()), Utf8Data.Length(), ConnectRequest);
+
+	TArray<uint8> Command;
+	WriteTag(CommandIdField, Varint, Command);
+	WriteVarint(Id, Command);
+	WriteBytes(CommandConnectField, ConnectRequest.GetData(), ConnectRequest.Num(), Command);
+
+	WriteVarint(Command.Num(), OutFrame);
+	OutFrame.Append(Command);
+}
+
+bool CentrifugoProtobufCodec::DecodeReplies(TConstArrayView<uint8> Frame, TFunctionRef<void(const FCentrifugoProtobufReply& Reply)> ReplyHandler)
+{
+	const uint8* Cur = Frame.GetData();
+	const uint8* End = Cur + Frame.Num();
+
+	while (Cur < End)
+	{
+		uint64 Length = 0;
+		if (!ReadVarint(Cur, End, Length) || Length > static_cast<uint64>(End - Cur))
+		{
+			return false;
+		}
+
+		FCentrifugoProtobufReply Reply;
+		if (!DecodeReply(MakeArrayView(Cur, static_cast<int32>(Length)), Reply))
+		{
+			return false;
+		}
+
+		Cur += Length;
+		ReplyHandler(Reply);
+	}
+
+	return true;
+}
+
+void CentrifugoProtobufCodec::WriteVarint(uint64 Value, TArray<uint8>& OutFrame)
+{
+	while (Value >= 0x80)
+	{
+		OutFrame.Add(static_cast<uint8>(Value | 0x80));
+		Value >>= 7;
+	}
+	OutFrame.Add(static_cast<uint8>(Value));
+}
+
+void CentrifugoProtobufCodec::WriteTag(const uint32 FieldNumber, const uint32 WireType, TArray<uint8>& OutFrame)
+{
+	WriteVarint((FieldNumber << 3) | WireType, OutFrame);
+}
+
+void CentrifugoProtobufCodec::WriteBytes(const uint32 FieldNumber, const uint8* Data, const int32 Size, TArray<uint8>& OutFrame)
+{
+	WriteTag(FieldNumber, LengthDelimited, OutFrame);
+	WriteVarint(Size, OutFrame);
+	OutFrame.Append(Data, Size);
+}
+
+bool CentrifugoProtobufCodec::ReadVarint(const uint8*& Cur, const uint8* End, uint64& OutValue)
+{
+	OutValue = 0;
+	for (int32 Shift = 0; Shift < 64; Shift += 7)
+	{
+		if (Cur >= End)
+		{
+			return false;
+		}
+
+		const uint8 Byte = *Cur++;
+		OutValue |= static_cast<uint64>(Byte & 0x7F) << Shift;
+		if ((Byte & 0x80) == 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool CentrifugoProtobufCodec::ReadField(const uint8*& Cur, const uint8* End, uint32& OutFieldNumber, uint32& OutWireType,
+	uint64& OutVarint, TConstArrayView<uint8>& OutPayload)
+{
+	uint64 Key = 0;
+	if (!ReadVarint(Cur, End, Key))
+	{
+		return false;
+	}
+
+	OutFieldNumber = static_cast<uint32>(Key >> 3);
+	OutWireType = static_cast<uint32>(Key & 0x07);
+
+	switch (OutWireType)
+	{
+	case Varint:
+		return ReadVarint(Cur, End, OutVarint);
+
+	case Fixed64:
+	case Fixed32:
+	{
+		const int64 Size = OutWireType == Fixed64 ? 8 : 4;
+		if (End - Cur < Size)
+		{
+			return false;
+		}
+		Cur += Size;
+		return true;
+	}
+
+	case LengthDelimited:
+	{
+		uint64 Length = 0;
+		if (!ReadVarint(Cur, End, Length) || Length > static_cast<uint64>(End - Cur))
+		{
+			return false;
+		}
+		OutPayload = MakeArrayView(Cur, static_cast<int32>(Length));
+		Cur += Length;
+		return true;
+	}
+
+	default:
+		// Groups are deprecated and never used by Centrifugo
+		return false;
+	}
+}
+
+bool CentrifugoProtobufCodec::DecodeReply(TConstArrayView<uint8> Message, FCentrifugoProtobufReply& OutReply)
+{
+	OutReply.bIsPing = Message.Num() == 0;
+
+	const uint8* Cur = Message.GetData();
+	const uint8* End = Cur + Message.Num();
+
+	while (Cur < End)
+	{
+		uint32 FieldNumber = 0;
+		uint32 WireType = 0;
+		uint64 VarintValue = 0;
+		TConstArrayView<uint8> Payload;
+		if (!ReadField(Cur, End, FieldNumber, WireType, VarintValue, Payload))
+		{
+			return false;
+		}
+
+		if (FieldNumber == ReplyIdField && WireType == Varint)
+		{
+			OutReply.Id = static_cast<uint32>(VarintValue);
+		}
+		else if (FieldNumber == ReplyErrorField && WireType == LengthDelimited)
+		{
+			OutReply.bHasError = true;
+			if (!DecodeError(Payload, OutReply))
+			{
+				return false;
+			}
+		}
+		else if (FieldNumber == ReplyPushField && WireType == LengthDelimited)
+		{
+			OutReply.bHasPush = true;
+			if (!DecodePush(Payload, OutReply.OrderStatusMessage.push))
+			{
+				return false;
+			}
+		}
+		else if (FieldNumber == ReplyConnectField && WireType == LengthDelimited)
+		{
+			OutReply.bIsConnect = true;
+			if (!DecodeConnectResult(Payload, OutReply))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool CentrifugoProtobufCodec::DecodeConnectResult(TConstArrayView<uint8> Message, FCentrifugoProtobufReply& OutReply)
+{
+	const uint8* Cur = Message.GetData();
+	const uint8* End = Cur + Message.Num();
+
+	while (Cur < End)
+	{
+		uint32 FieldNumber = 0;
+		uint32 WireType = 0;
+		uint64 VarintValue = 0;
+		TConstArrayView<uint8> Payload;
+		if (!ReadField(Cur, End, FieldNumber, WireType, VarintValue, Payload))
+		{
+			return false;
+		}
+
+		// Other connect result fields aren't used, the reply itself confirms connection
+		if (FieldNumber == ConnectResultPingField && WireType == Varint)
+		{
+			OutReply.PingInterval = static_cast<uint32>(VarintValue);
+		}
+	}
+
+	return true;
+}
+
+bool CentrifugoProtobufCodec::DecodeError(TConstArrayView<uint8> Message, FCentrifugoProtobufReply& OutReply)
+{
+	const uint8* Cur = Message.GetData();
+	const uint8* End = Cur + Message.Num();
+
+	while (Cur < End)
+	{
+		uint32 FieldNumber = 0;
+		uint32 WireType = 0;
+		uint64 VarintValue = 0;
+		TConstArrayView<uint8> Payload;
+		if (!ReadField(Cur, End, FieldNumber, WireType, VarintValue, Payload))
+		{
+			return false;
+		}
+
+		if (FieldNumber == ErrorCodeField && WireType == Varint)
+		{
+			OutReply.ErrorCode = static_cast<uint32>(VarintValue);
+		}
+		else if (FieldNumber == ErrorMessageField && WireType == LengthDelimited)
+		{
+			OutReply.ErrorMessage = ToString(Payload);
+		}
+	}
+
+	return true;
+}
+
+bool CentrifugoProtobufCodec::DecodePush(TConstArrayView<uint8> Message, FOrderStatusPush& OutPush)
+{
+	const uint8* Cur = Message.GetData();
+	const uint8* End = Cur + Message.Num();
+
+	while (Cur < End)
+	{
+		uint32 FieldNumber = 0;
+		uint32 WireType = 0;
+		uint64 VarintValue = 0;
+		TConstArrayView<uint8> Payload;
+		if (!ReadField(Cur, End, FieldNumber, WireType, VarintValue, Payload))
+		{
+			return false;
+		}
+
+		if (FieldNumber == PushChannelField && WireType == LengthDelimited)
+		{
+			OutPush.channel = ToString(Payload);
+		}
+		else if (FieldNumber == PushPubField && WireType == LengthDelimited)
+		{
+			if (!DecodePublication(Payload, OutPush.pub))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool CentrifugoProtobufCodec::DecodePublication(TConstArrayView<uint8> Message, FOrderStatusPub& OutPub)
+{
+	const uint8* Cur = Message.GetData();
+	const uint8* End = Cur + Message.Num();
+
+	while (Cur < End)
+	{
+		uint32 FieldNumber = 0;
+		uint32 WireType = 0;
+		uint64 VarintValue = 0;
+		TConstArrayView<uint8> Payload;
+		if (!ReadField(Cur, End, FieldNumber, WireType, VarintValue, Payload))
+		{
+			return false;
+		}
+
+		if (FieldNumber == PublicationDataField && WireType == LengthDelimited)
+		{
+			XsollaUtilsJsonStructReader Reader(Payload.GetData(), Payload.Num());
+			if (!Reader.ReadValue(OutPub.data))
+			{
+				UE_LOG(LogXsollaCentrifugo, Warning, TEXT("%s: Can't decode publication data"), *VA_FUNC_LINE);
+				return false;
+			}
+		}
+		else if (FieldNumber == PublicationOffsetField && WireType == Varint)
+		{
+			OutPub.offset = static_cast<int32>(VarintValue);
+		}
+	}
+
+	return true;
+}
+
+FString CentrifugoProtobufCodec::ToString(TConstArrayView<uint8> Utf8)
+{
+	return FString(Utf8.Num(), reinterpret_cast<const UTF8CHAR*>(Utf8.GetData()));
+}
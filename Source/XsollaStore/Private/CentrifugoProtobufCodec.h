@@ -0,0 +1,63 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "XsollaCentrifugoDataModel.h"
+#include "Templates/Function.h"
+
+/** Decoded Centrifugo reply. Only the fields the SDK uses are decoded. */
+struct FCentrifugoProtobufReply
+{
+	uint32 Id = 0;
+
+	/** Empty reply is a server ping. */
+	bool bIsPing = false;
+
+	bool bIsConnect = false;
+
+	/** Server ping interval from connect result. */
+	uint32 PingInterval = 0;
+
+	bool bHasError = false;
+	uint32 ErrorCode = 0;
+	FString ErrorMessage;
+
+	bool bHasPush = false;
+	FOrderStatusMessage OrderStatusMessage;
+};
+
+/**
+ * Encoder and decoder of Centrifugo protobuf protocol messages.
+ *
+ * Frames contain length-delimited Command (client) or Reply (server) messages. Publication data is JSON
+ * the same as in JSON protocol, so it's decoded into FOrderStatusData with XsollaUtilsJsonStructReader.
+ */
+class CentrifugoProtobufCodec
+{
+public:
+	/** Appends connect command with custom connection data (JSON) to the frame. */
+	static void EncodeConnectCommand(const uint32 Id, const FString& Data, TArray<uint8>& OutFrame);
+
+	/** Decodes all replies from the frame. Returns false if the frame is malformed. */
+	static bool DecodeReplies(TConstArrayView<uint8> Frame, TFunctionRef<void(const FCentrifugoProtobufReply& Reply)> ReplyHandler);
+
+private:
+	static void WriteVarint(uint64 Value, TArray<uint8>& OutFrame);
+	static void WriteTag(const uint32 FieldNumber, const uint32 WireType, TArray<uint8>& OutFrame);
+	static void WriteBytes(const uint32 FieldNumber, const uint8* Data, const int32 Size, TArray<uint8>& OutFrame);
+
+	static bool ReadVarint(const uint8*& Cur, const uint8* End, uint64& OutValue);
+
+	/** Reads field key and, for length-delimited fields, its payload. */
+	static bool ReadField(const uint8*& Cur, const uint8* End, uint32& OutFieldNumber, uint32& OutWireType,
+		uint64& OutVarint, TConstArrayView<uint8>& OutPayload);
+
+	static bool DecodeReply(TConstArrayView<uint8> Message, FCentrifugoProtobufReply& OutReply);
+	static bool DecodeConnectResult(TConstArrayView<uint8> Message, FCentrifugoProtobufReply& OutReply);
+	static bool DecodeError(TConstArrayView<uint8> Message, FCentrifugoProtobufReply& OutReply);
+	static bool DecodePush(TConstArrayView<uint8> Message, FOrderStatusPush& OutPush);
+	static bool DecodePublication(TConstArrayView<uint8> Message, FOrderStatusPub& OutPub);
+
+	static FString ToString(TConstArrayView<uint8> Utf8);
+};
@@ -11,32 +11,123 @@
 #include "XsollaCentrifugoDataModel.h"
 #include "Engine/EngineTypes.h"
 #include "Engine/GameInstance.h"
+#include "JsonObjectConverter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+#include "XsollaUtilsJsonStructReader.h"
+#include "CentrifugoProtobufCodec.h"
 
 void UCentrifugoServiceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
+	const UXsollaProjectSettings* Settings = FXsollaSettingsModule::Get().GetSettings();
+	bUseProtobuf = Settings->UseCentrifugoProtobuf;
+	bKeepConnection = Settings->KeepCentrifugoConnection;
 
 	UE_LOG(LogXsollaCentrifugo, Log, TEXT("%s: CentrifugoService subsystem initialized"), *VA_FUNC_LINE);
 }
 
-void UCentrifugoServiceSubsystem::AddTracker(const UXsollaOrderCheckObject* Tracker)
+void UCentrifugoServiceSubsystem::Deinitialize()
 {
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(KeepaliveTimerHandle);
+		World->GetTimerManager().ClearTimer(ReconnectTimerHandle);
+	}
+
+	if (CentrifugoClient != nullptr)
+	{
+		CentrifugoClient->MessageReceived.Unbind();
+		CentrifugoClient->Error.Unbind();
+		CentrifugoClient->Closed.Unbind();
+		CentrifugoClient->Disconnect();
+		CentrifugoClient = nullptr;
+	}
+
+	Trackers.Empty();
+	TrackersByOrderId.Empty();
+
+	Super::Deinitialize();
+}
+
+void UCentrifugoServiceSubsystem::Preconnect(const FString& AccessToken)
+{
+	if (!bKeepConnection)
+	{
+		UE_LOG(LogXsollaCentrifugo, Warning, TEXT("%s: Preconnect is ignored because KeepCentrifugoConnection setting is disabled"), *VA_FUNC_LINE);
+		return;
+	}
+
+	if (CentrifugoClient != nullptr && ConnectionAccessToken == AccessToken)
+	{
+		return;
+	}
+
+	// Connection of the previous user can't be reused
+	if (CentrifugoClient != nullptr && Trackers.Num() == 0)
+	{
+		CloseConnection();
+	}
+
+	ConnectionAccessToken = AccessToken;
+	if (CentrifugoClient == nullptr)
+	{
+		CreateCentrifugoClient(AccessToken);
+	}
+}
+
+void UCentrifugoServiceSubsystem::AddTracker(UXsollaOrderCheckObject* Tracker)
+{
+	const bool bWasIdle = Trackers.Num() == 0;
+
 	Trackers.Add(Tracker);
+	TrackersByOrderId.FindOrAdd(Tracker->GetOrderId()).AddUnique(Tracker);
+
+	const FString& AccessToken = Tracker->GetAccessToken();
+	if (CentrifugoClient != nullptr && bWasIdle && ConnectionAccessToken != AccessToken)
+	{
+		// Kept connection was authenticated with another token, e.g. before the user changed
+		CloseConnection();
+	}
 
+	ConnectionAccessToken = AccessToken;
 	if (CentrifugoClient == nullptr)
 	{
-		CreateCentrifugoClient(Tracker->GetAccessToken());
+		CreateCentrifugoClient(AccessToken);
 	}
 }
 
-void UCentrifugoServiceSubsystem::RemoveTracker(const UXsollaOrderCheckObject* Tracker)
+void UCentrifugoServiceSubsystem::RemoveTracker(UXsollaOrderCheckObject* Tracker)
 {
 	Trackers.Remove(Tracker);
 
-	if (Trackers.Num() == 0 && CentrifugoClient != nullptr)
+	if (auto* OrderTrackers = TrackersByOrderId.Find(Tracker->GetOrderId()))
 	{
-		TerminateCentrifugoClient();
+		OrderTrackers->Remove(Tracker);
+		if (OrderTrackers->Num() == 0)
+		{
+			TrackersByOrderId.Remove(Tracker->GetOrderId());
+		}
+	}
+
+	if (Trackers.Num() == 0 && CentrifugoClient != nullptr && !bKeepConnection)
+	{
+		CloseConnection();
 	}
-	
+}
+
+bool UCentrifugoServiceSubsystem::IsConnectionLost() const
+{
+	return bIsFallbackActive;
+}
+
+void UCentrifugoServiceSubsystem::CloseConnection()
+{
+	TerminateCentrifugoClient();
+
+	GetWorld()->GetTimerManager().ClearTimer(ReconnectTimerHandle);
+	ReconnectAttempt = 0;
+	bIsReconnecting = false;
+	bIsFallbackActive = false;
 }
 
 void UCentrifugoServiceSubsystem::CreateCentrifugoClient(const FString& AccessToken)
@@ -45,7 +136,7 @@ void UCentrifugoServiceSubsystem::CreateCentrifugoClient(const FString& AccessTo
 	CentrifugoClient->MessageReceived.BindUObject(this, &UCentrifugoServiceSubsystem::OnCentrifugoMessageReceived);
 	CentrifugoClient->Error.BindUObject(this, &UCentrifugoServiceSubsystem::OnCentrifugoError);
 	CentrifugoClient->Closed.BindUObject(this, &UCentrifugoServiceSubsystem::OnCentrifugoClosed);
-	CentrifugoClient->Connect();
+	CentrifugoClient->Connect(bUseProtobuf);
 
 	const UXsollaProjectSettings* Settings = FXsollaSettingsModule::Get().GetSettings();
 	int32 Id = static_cast<int32>(GetTypeHash(FGuid::NewGuid().ToString()));
@@ -54,15 +145,32 @@ void UCentrifugoServiceSubsystem::CreateCentrifugoClient(const FString& AccessTo
 
 	FConnectionMessage ConnectionMessage = FConnectionMessage(AccessToken, ProjectId, Id);
 	TSharedRef<FJsonObject> ConnectionMessageJson = MakeShareable(new FJsonObject());
-	if (FJsonObjectConverter::UStructToJsonObject(FConnectionMessage::StaticStruct(), &ConnectionMessage, ConnectionMessageJson, 0, 0))
+	if (bUseProtobuf)
+	{
+		// Protobuf connect command carries the same custom data as JSON
+		TSharedRef<FJsonObject> ConnectionDataJson = MakeShareable(new FJsonObject());
+		if (FJsonObjectConverter::UStructToJsonObject(FConnectionData::StaticStruct(), &ConnectionMessage.connect.data, ConnectionDataJson, 0, 0))
+		{
+			FString Data;
+			TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Data);
+			FJsonSerializer::Serialize(ConnectionDataJson, Writer);
+
+			TArray<uint8> Frame;
+			CentrifugoProtobufCodec::EncodeConnectCommand(ConnectionMessage.id, Data, Frame);
+			CentrifugoClient->Send(Frame);
+		}
+	}
+	else if (FJsonObjectConverter::UStructToJsonObject(FConnectionMessage::StaticStruct(), &ConnectionMessage, ConnectionMessageJson, 0, 0))
 	{
 		FString Data;
-		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Data);
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Data);
 		FJsonSerializer::Serialize(ConnectionMessageJson, Writer);
 		CentrifugoClient->Send(Data);
 	}
 
-	GetWorld()->GetTimerManager().SetTimer(PingTimerHandle, this, &UCentrifugoServiceSubsystem::DoPing, 1.f, true);
+	// Server ping interval is unknown until connect reply
+	ServerPingInterval = 0.f;
+	ScheduleKeepalive(GetKeepaliveTimeout());
 	UE_LOG(LogXsollaCentrifugo, Log, TEXT("Centrifugo client created"));
 }
 
@@ -74,72 +182,237 @@ void UCentrifugoServiceSubsystem::TerminateCentrifugoClient()
 	CentrifugoClient->Disconnect();
 	CentrifugoClient = nullptr;
 
-	GetWorld()->GetTimerManager().ClearTimer(PingTimerHandle);
+	GetWorld()->GetTimerManager().ClearTimer(KeepaliveTimerHandle);
 
 	UE_LOG(LogXsollaCentrifugo, Log, TEXT("Centrifugo client terminated"));
 }
 
-void UCentrifugoServiceSubsystem::OnCentrifugoMessageReceived(const FString& Message)
+void UCentrifugoServiceSubsystem::OnCentrifugoMessageReceived(TConstArrayView<uint8> Message)
+{
+	if (CentrifugoClient->IsUsingProtobuf())
+	{
+		HandleProtobufMessage(Message);
+	}
+	else
+	{
+		HandleJsonMessage(Message);
+	}
+}
+
+void UCentrifugoServiceSubsystem::HandleProtobufMessage(TConstArrayView<uint8> Message)
 {
-	PingCounter = 0;
+	const bool bDecoded = CentrifugoProtobufCodec::DecodeReplies(Message, [this](const FCentrifugoProtobufReply& Reply)
+	{
+		if (Reply.bIsPing)
+		{
+			CentrifugoClient->SendPing();
+		}
+		else if (Reply.bHasError)
+		{
+			UE_LOG(LogXsollaCentrifugo, Warning, TEXT("%s: Centrifugo error %u: %s"), *VA_FUNC_LINE, Reply.ErrorCode, *Reply.ErrorMessage);
+		}
+		else if (Reply.bIsConnect)
+		{
+			UE_LOG(LogXsollaCentrifugo, Log, TEXT("Connect message received."));
+			bIsProtobufConfirmed = true;
+			OnCentrifugoConnected(Reply.PingInterval);
+		}
+		else if (Reply.bHasPush)
+		{
+			DispatchOrderStatus(Reply.OrderStatusMessage.push.pub.data);
+		}
+	});
 
-	TSharedPtr<FJsonObject> JsonObject;
-	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(*Message);
+	if (!bDecoded)
+	{
+		UE_LOG(LogXsollaCentrifugo, Warning, TEXT("Can't decode received centrifugo protobuf message."));
+	}
+}
 
-	if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
+void UCentrifugoServiceSubsystem::HandleJsonMessage(TConstArrayView<uint8> Message)
+{
+	XsollaUtilsJsonStructReader Reader(Message.GetData(), Message.Num());
+
+	// Server may batch several replies into one frame, separated with new lines
+	do
 	{
+		bool bIsConnectReply = false;
+		int32 PingInterval = 0;
+		bool bHasPush = false;
 		FOrderStatusMessage OrderStatusMessage;
-		if (FJsonObjectConverter::JsonObjectToUStruct(JsonObject.ToSharedRef(), FOrderStatusMessage::StaticStruct(), &OrderStatusMessage))
+
+		const bool bParsed = Reader.ReadObjectFields([&Reader, &bIsConnectReply, &PingInterval, &bHasPush, &OrderStatusMessage](FUtf8StringView FieldName)
 		{
-			OrderStatusUpdated.Broadcast(OrderStatusMessage.push.pub.data);
+			if (FieldName.Equals(UTF8TEXTVIEW("push")))
+			{
+				bHasPush = true;
+				return Reader.ConsumeNull() || Reader.ReadValue(OrderStatusMessage.push);
+			}
+
+			if (FieldName.Equals(UTF8TEXTVIEW("connect")))
+			{
+				bIsConnectReply = true;
+				return Reader.ConsumeNull() || Reader.ReadObjectFields([&Reader, &PingInterval](FUtf8StringView ConnectFieldName)
+				{
+					if (ConnectFieldName.Equals(UTF8TEXTVIEW("ping")))
+					{
+						return Reader.ConsumeNull() || Reader.ReadValue(PingInterval);
+					}
+
+					return Reader.SkipValue();
+				});
+			}
+
+			return Reader.SkipValue();
+		});
+
+		if (!bParsed)
+		{
+			UE_LOG(LogXsollaCentrifugo, Warning, TEXT("Can't parse received centrifugo message."));
 			return;
 		}
 
-		static const FString ConnectFieldName = TEXT("connect");
-		if (JsonObject->HasTypedField<EJson::Object>(ConnectFieldName))
+		if (bIsConnectReply)
 		{
 			UE_LOG(LogXsollaCentrifugo, Log, TEXT("Connect message received."));
-			return;
+			OnCentrifugoConnected(PingInterval);
+		}
+		else if (bHasPush)
+		{
+			DispatchOrderStatus(OrderStatusMessage.push.pub.data);
 		}
+		else
+		{
+			UE_LOG(LogXsollaCentrifugo, Verbose, TEXT("Centrifugo reply without push received."));
+		}
+	} while (!Reader.IsAtEnd());
+}
 
-		UE_LOG(LogXsollaCentrifugo, Warning, TEXT("Can't parse received centrifugo message into OrderStatusMessage."));
-	 }
-	else
+void UCentrifugoServiceSubsystem::OnCentrifugoError(const FString& ErrorMessage)
+{
+	OnConnectionLost();
+}
+
+void UCentrifugoServiceSubsystem::OnCentrifugoClosed(const FString& Reason)
+{
+	OnConnectionLost();
+}
+
+void UCentrifugoServiceSubsystem::OnCentrifugoConnected(const int32 InServerPingInterval)
+{
+	ReconnectAttempt = 0;
+
+	ServerPingInterval = FMath::Max(InServerPingInterval, 0);
+	ScheduleKeepalive(GetKeepaliveTimeout());
+
+	if (bIsReconnecting)
 	{
-		UE_LOG(LogXsollaCentrifugo, Warning, TEXT("Can't parse received centrifugo message."));
+		UE_LOG(LogXsollaCentrifugo, Log, TEXT("%s: Centrifugo connection restored"), *VA_FUNC_LINE);
+		bIsReconnecting = false;
+		bIsFallbackActive = false;
+		ConnectionRestored.Broadcast();
 	}
 }
 
-void UCentrifugoServiceSubsystem::OnCentrifugoError(const FString& ErrorMessage)
+void UCentrifugoServiceSubsystem::OnConnectionLost()
+{
+	// Error and close may both be reported for the same connection
+	if (GetWorld()->GetTimerManager().IsTimerActive(ReconnectTimerHandle))
+	{
+		return;
+	}
+
+	GetWorld()->GetTimerManager().ClearTimer(KeepaliveTimerHandle);
+	bIsReconnecting = true;
+
+	// Server that never replied over protobuf may not support it
+	if (bUseProtobuf && !bIsProtobufConfirmed)
+	{
+		UE_LOG(LogXsollaCentrifugo, Warning, TEXT("%s: Centrifugo protobuf connection failed, switching to JSON protocol"), *VA_FUNC_LINE);
+		bUseProtobuf = false;
+	}
+
+	if (!bIsFallbackActive && ReconnectAttempt >= ReconnectAttemptsBeforeFallback)
+	{
+		UE_LOG(LogXsollaCentrifugo, Warning, TEXT("%s: Can't restore Centrifugo connection, falling back to polling"), *VA_FUNC_LINE);
+		bIsFallbackActive = true;
+		ConnectionLost.Broadcast();
+	}
+
+	ScheduleReconnect();
+}
+
+void UCentrifugoServiceSubsystem::ScheduleReconnect()
 {
-	Error.Broadcast();
+	const float Delay = FMath::Min(ReconnectMaxDelay, ReconnectBaseDelay * FMath::Pow(2.f, FMath::Min(ReconnectAttempt, 16)));
+
+	// Jitter keeps clients from reconnecting all at once after a server outage
+	const float JitteredDelay = Delay * FMath::FRandRange(0.5f, 1.f);
+	++ReconnectAttempt;
+
+	UE_LOG(LogXsollaCentrifugo, Log, TEXT("%s: Reconnecting to Centrifugo in %.1f s, attempt %d"), *VA_FUNC_LINE, JitteredDelay, ReconnectAttempt);
+	GetWorld()->GetTimerManager().SetTimer(ReconnectTimerHandle, this, &UCentrifugoServiceSubsystem::Reconnect, JitteredDelay, false);
 }
 
-void UCentrifugoServiceSubsystem::OnCentrifugoClosed(const FString& Reason)
+void UCentrifugoServiceSubsystem::Reconnect()
 {
-	Close.Broadcast();
+	if (Trackers.Num() == 0 && !bKeepConnection)
+	{
+		return;
+	}
+
+	// Connect message authenticates the connection again, so the server restores its subscriptions
+	TerminateCentrifugoClient();
+	CreateCentrifugoClient(ConnectionAccessToken);
 }
 
-void UCentrifugoServiceSubsystem::DoPing()
+void UCentrifugoServiceSubsystem::DispatchOrderStatus(const FOrderStatusData& Data)
 {
-	PingCounter += 1;
-	if (PingCounter >= PingInterval)
+	const auto* OrderTrackers = TrackersByOrderId.Find(Data.order_id);
+	if (!OrderTrackers)
 	{
-		PingCounter = 0;
-		CentrifugoClient->SendPing();
-		if (CentrifugoClient->IsAlive())
-		{
-			TimeoutCounter = 0;
-		}
-		else
-		{
-			TimeoutCounter += PingInterval;
-			if (TimeoutCounter >= TimeoutLimit)
-			{
-				UE_LOG(LogXsollaCentrifugo, Warning, TEXT("Centrifugo connection timeout limit exceeded"));
-				OnCentrifugoClosed("Network problems");
-				GetWorld()->GetTimerManager().ClearTimer(PingTimerHandle);
-			}
-		}
+		UE_LOG(LogXsollaCentrifugo, Verbose, TEXT("%s: No trackers for order %d"), *VA_FUNC_LINE, Data.order_id);
+		return;
+	}
+
+	// Trackers remove themselves when the order is completed, so iterate over a copy
+	const TArray<UXsollaOrderCheckObject*, TInlineAllocator<1>> OrderTrackersCopy = *OrderTrackers;
+	for (UXsollaOrderCheckObject* Tracker : OrderTrackersCopy)
+	{
+		Tracker->OnOrderStatusUpdated(Data);
+	}
+}
+
+float UCentrifugoServiceSubsystem::GetKeepaliveTimeout() const
+{
+	return ServerPingInterval > 0.f ? ServerPingInterval + ServerPingDelayTolerance : PingInterval;
+}
+
+void UCentrifugoServiceSubsystem::ScheduleKeepalive(const float Delay)
+{
+	GetWorld()->GetTimerManager().SetTimer(KeepaliveTimerHandle, this, &UCentrifugoServiceSubsystem::OnKeepaliveDeadline, Delay, false);
+}
+
+void UCentrifugoServiceSubsystem::OnKeepaliveDeadline()
+{
+	const float Timeout = GetKeepaliveTimeout();
+	const float SilenceTime = static_cast<float>(FPlatformTime::Seconds() - CentrifugoClient->GetLastMessageTime());
+
+	// Deadline isn't moved on every message, it's checked against the last message time instead
+	if (SilenceTime < Timeout)
+	{
+		ScheduleKeepalive(Timeout - SilenceTime);
+		return;
 	}
+
+	if (ServerPingInterval > 0.f || !CentrifugoClient->IsAlive())
+	{
+		UE_LOG(LogXsollaCentrifugo, Warning, TEXT("%s: No messages from Centrifugo for %.0f s, connection is lost"), *VA_FUNC_LINE, SilenceTime);
+		OnConnectionLost();
+		return;
+	}
+
+	// Server doesn't send pings, so the client pings to keep connection open
+	CentrifugoClient->SendPing();
+	ScheduleKeepalive(PingInterval);
 }
@@ -11,8 +11,6 @@
 class UXsollaOrderCheckObject;
 class UCentrifugoClient;
 
-DECLARE_MULTICAST_DELEGATE_OneParam(FOnOrderStatusUpdated, const FOrderStatusData);
-
 UCLASS(NotBlueprintType)
 class UCentrifugoServiceSubsystem : public UGameInstanceSubsystem
 {
@@ -21,14 +19,24 @@ class UCentrifugoServiceSubsystem : public UGameInstanceSubsystem
 public:
 	// Begin USubsystem
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
 	// End USubsystem
 
-	void AddTracker(const UXsollaOrderCheckObject* Tracker);
-	void RemoveTracker(const UXsollaOrderCheckObject* Tracker);
+	/** Opens connection in advance so that order tracking doesn't wait for the handshake. Requires KeepCentrifugoConnection setting. */
+	void Preconnect(const FString& AccessToken);
+
+	/** Registers tracker, order status updates are dispatched only to trackers of the same order. */
+	void AddTracker(UXsollaOrderCheckObject* Tracker);
+	void RemoveTracker(UXsollaOrderCheckObject* Tracker);
+
+	/** Whether ConnectionLost was broadcast and connection isn't restored yet. */
+	bool IsConnectionLost() const;
+
+	/** Called when connection can't be restored after several attempts. Trackers should poll order status until it is restored. */
+	FSimpleMulticastDelegate ConnectionLost;
 
-	FOnOrderStatusUpdated OrderStatusUpdated;
-	FSimpleMulticastDelegate Error;
-	FSimpleMulticastDelegate Close;
+	/** Called when connection is restored after being lost. Order updates sent in between are missed. */
+	FSimpleMulticastDelegate ConnectionRestored;
 
 protected:
 	/** Cached Xsolla Store project id */
@@ -38,22 +46,65 @@ private:
 	void CreateCentrifugoClient(const FString& AccessToken);
 	void TerminateCentrifugoClient();
 
-	void OnCentrifugoMessageReceived(const FString& Message);
+	/** Closes connection and resets reconnection state. */
+	void CloseConnection();
+
+	void OnCentrifugoMessageReceived(TConstArrayView<uint8> Message);
+	void HandleProtobufMessage(TConstArrayView<uint8> Message);
+	void HandleJsonMessage(TConstArrayView<uint8> Message);
 	void OnCentrifugoError(const FString& ErrorMessage);
 	void OnCentrifugoClosed(const FString& Reason);
+	void OnCentrifugoConnected(const int32 InServerPingInterval);
+
+	/** Schedules reconnection and falls back to polling if connection isn't restored for a while. */
+	void OnConnectionLost();
+	void ScheduleReconnect();
+	void Reconnect();
+
+	void DispatchOrderStatus(const FOrderStatusData& Data);
+
+	/** Returns how long the connection may stay silent. */
+	float GetKeepaliveTimeout() const;
+	void ScheduleKeepalive(const float Delay);
+	void OnKeepaliveDeadline();
 
-	void DoPing();
+	/** Client ping interval, used when the server doesn't send pings. */
+	float PingInterval = 25.f;
 
-	int32 PingInterval = 25;
-	int32 TimeoutLimit = 600;
-	int32 PingCounter = 0;
-	int32 TimeoutCounter = 0;
-	FTimerHandle PingTimerHandle;
+	/** Delay of server ping after which connection is considered lost. */
+	float ServerPingDelayTolerance = 10.f;
+
+	/** Server ping interval from connect reply, zero if the server doesn't send pings. */
+	float ServerPingInterval = 0.f;
+
+	FTimerHandle KeepaliveTimerHandle;
+
+	/** Reconnection delay doubles with each attempt from the base value up to the max value, and is randomized. */
+	float ReconnectBaseDelay = 1.f;
+	float ReconnectMaxDelay = 30.f;
+	int32 ReconnectAttemptsBeforeFallback = 3;
+	int32 ReconnectAttempt = 0;
+	bool bIsReconnecting = false;
+	bool bIsFallbackActive = false;
+	FTimerHandle ReconnectTimerHandle;
+
+	/** Whether connection is kept open when no orders are tracked. */
+	bool bKeepConnection = false;
+
+	/** Token the connection is authenticated with. The latest token of added trackers is used for reconnection. */
+	FString ConnectionAccessToken;
+
+	/** Whether protobuf protocol is used. Reset if the server doesn't accept protobuf connection. */
+	bool bUseProtobuf = false;
+	bool bIsProtobufConfirmed = false;
 
 	UPROPERTY()
 	UCentrifugoClient* CentrifugoClient;
 
 	UPROPERTY()
-	TArray<const UXsollaOrderCheckObject*> Trackers;
+	TArray<UXsollaOrderCheckObject*> Trackers;
+
+	/** Trackers by order ID. Usually there is one tracker per order, but the same order may be tracked twice. */
+	TMap<int32, TArray<UXsollaOrderCheckObject*, TInlineAllocator<1>>> TrackersByOrderId;
 
 };
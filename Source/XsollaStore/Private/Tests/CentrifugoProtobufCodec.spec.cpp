@@ -0,0 +1,139 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CentrifugoProtobufCodec.h"
+
+namespace CentrifugoProtobufCodecSpec
+{
+	// Frames as sent by Centrifugo: each reply is prefixed with its varint length
+
+	/** Connect reply with id 1, client ID, ping interval 25 and pong flag. */
+	const uint8 ConnectFrame[] = {
+		0x13, 0x08, 0x01, 0x2A, 0x0F, 0x0A, 0x09, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x2D, 0x69, 0x64, 0x38, 0x19, 0x40, 0x01};
+
+	/** Push of order 12345 status `done` at offset 7 to channel `orders:12345`, followed by a server ping in the same frame. */
+	const uint8 PushAndPingFrame[] = {
+		0x38, 0x22, 0x36, 0x12, 0x0C, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x31, 0x32, 0x33, 0x34, 0x35, 0x22, 0x26, 0x22,
+		0x22, 0x7B, 0x22, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x5F, 0x69, 0x64, 0x22, 0x3A, 0x31, 0x32, 0x33, 0x34, 0x35, 0x2C, 0x22,
+		0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x22, 0x3A, 0x22, 0x64, 0x6F, 0x6E, 0x65, 0x22, 0x7D, 0x30, 0x07, 0x00};
+
+	/** Error reply with id 1, code 109 and message `token expired`. */
+	const uint8 ErrorFrame[] = {
+		0x15, 0x08, 0x01, 0x12, 0x11, 0x08, 0x6D, 0x12, 0x0D, 0x74, 0x6F, 0x6B, 0x65, 0x6E, 0x20, 0x65, 0x78, 0x70, 0x69, 0x72,
+		0x65, 0x64};
+
+	/** Connect command with id 1 and data `{"token":"abc"}`. */
+	const uint8 ConnectCommandFrame[] = {
+		0x15, 0x08, 0x01, 0x22, 0x11, 0x12, 0x0F, 0x7B, 0x22, 0x74, 0x6F, 0x6B, 0x65, 0x6E, 0x22, 0x3A, 0x22, 0x61, 0x62, 0x63,
+		0x22, 0x7D};
+
+	TArray<FCentrifugoProtobufReply> DecodeAll(TConstArrayView<uint8> Frame, bool& bOutSucceeded)
+	{
+		TArray<FCentrifugoProtobufReply> Replies;
+		bOutSucceeded = CentrifugoProtobufCodec::DecodeReplies(Frame, [&Replies](const FCentrifugoProtobufReply& Reply)
+		{
+			Replies.Add(Reply);
+		});
+		return Replies;
+	}
+}
+
+BEGIN_DEFINE_SPEC(FCentrifugoProtobufCodecSpec, "Xsolla.Store.CentrifugoProtobufCodec",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FCentrifugoProtobufCodecSpec)
+
+void FCentrifugoProtobufCodecSpec::Define()
+{
+	using namespace CentrifugoProtobufCodecSpec;
+
+	Describe("EncodeConnectCommand", [this]()
+	{
+		It("should encode id and connection data", [this]()
+		{
+			TArray<uint8> Frame;
+			CentrifugoProtobufCodec::EncodeConnectCommand(1, TEXT("{\"token\":\"abc\"}"), Frame);
+			TestEqual("Frame", Frame, TArray<uint8>(ConnectCommandFrame, UE_ARRAY_COUNT(ConnectCommandFrame)));
+		});
+
+		It("should append to existing frame data", [this]()
+		{
+			TArray<uint8> Frame({0x00});
+			CentrifugoProtobufCodec::EncodeConnectCommand(1, TEXT("{\"token\":\"abc\"}"), Frame);
+			TestEqual("Frame size", Frame.Num(), 1 + static_cast<int32>(UE_ARRAY_COUNT(ConnectCommandFrame)));
+			TestEqual("Existing data", Frame[0], static_cast<uint8>(0));
+		});
+	});
+
+	Describe("DecodeReplies", [this]()
+	{
+		It("should decode connect reply and skip unused fields", [this]()
+		{
+			bool bSucceeded = false;
+			const TArray<FCentrifugoProtobufReply> Replies = DecodeAll(MakeArrayView(ConnectFrame, UE_ARRAY_COUNT(ConnectFrame)), bSucceeded);
+			TestTrue("Succeeded", bSucceeded);
+			if (TestEqual("Replies", Replies.Num(), 1))
+			{
+				TestEqual("Id", Replies[0].Id, 1u);
+				TestTrue("Is connect", Replies[0].bIsConnect);
+				TestEqual("Ping interval", Replies[0].PingInterval, 25u);
+				TestFalse("Has error", Replies[0].bHasError);
+				TestFalse("Is ping", Replies[0].bIsPing);
+			}
+		});
+
+		It("should decode push and ping from one frame", [this]()
+		{
+			bool bSucceeded = false;
+			const TArray<FCentrifugoProtobufReply> Replies = DecodeAll(MakeArrayView(PushAndPingFrame, UE_ARRAY_COUNT(PushAndPingFrame)), bSucceeded);
+			TestTrue("Succeeded", bSucceeded);
+			if (TestEqual("Replies", Replies.Num(), 2))
+			{
+				const FOrderStatusPush& Push = Replies[0].OrderStatusMessage.push;
+				TestTrue("Has push", Replies[0].bHasPush);
+				TestEqual("Channel", Push.channel, TEXT("orders:12345"));
+				TestEqual("Order ID", Push.pub.data.order_id, 12345);
+				TestEqual("Status", Push.pub.data.status, TEXT("done"));
+				TestEqual("Offset", Push.pub.offset, 7);
+
+				TestTrue("Is ping", Replies[1].bIsPing);
+			}
+		});
+
+		It("should decode error reply", [this]()
+		{
+			bool bSucceeded = false;
+			const TArray<FCentrifugoProtobufReply> Replies = DecodeAll(MakeArrayView(ErrorFrame, UE_ARRAY_COUNT(ErrorFrame)), bSucceeded);
+			TestTrue("Succeeded", bSucceeded);
+			if (TestEqual("Replies", Replies.Num(), 1))
+			{
+				TestEqual("Id", Replies[0].Id, 1u);
+				TestTrue("Has error", Replies[0].bHasError);
+				TestEqual("Error code", Replies[0].ErrorCode, 109u);
+				TestEqual("Error message", Replies[0].ErrorMessage, TEXT("token expired"));
+			}
+		});
+
+		It("should reject truncated frame", [this]()
+		{
+			bool bSucceeded = true;
+			const TArray<FCentrifugoProtobufReply> Replies = DecodeAll(MakeArrayView(PushAndPingFrame, 20), bSucceeded);
+			TestFalse("Succeeded", bSucceeded);
+			TestEqual("Replies", Replies.Num(), 0);
+		});
+
+		It("should reject reply with malformed field", [this]()
+		{
+			// Reply of 2 bytes: id field key followed by an unterminated varint
+			const uint8 Frame[] = {0x02, 0x08, 0x80};
+
+			bool bSucceeded = true;
+			DecodeAll(MakeArrayView(Frame, UE_ARRAY_COUNT(Frame)), bSucceeded);
+			TestFalse("Succeeded", bSucceeded);
+		});
+	});
+}
+
+#endif
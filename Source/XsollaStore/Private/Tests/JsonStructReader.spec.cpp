@@ -0,0 +1,279 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "XsollaStoreDataModel.h"
+#include "XsollaUtilsJsonStructReader.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/MemoryBase.h"
+#include "JsonObjectConverter.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace JsonStructReaderSpec
+{
+	const int32 FixtureItemsCount = 500;
+
+	/** Decoding runs per measurement. */
+	const int32 BenchmarkIterations = 20;
+
+	const TCHAR* VirtualItemTypes[] = {TEXT("consumable"), TEXT("non_consumable"), TEXT("non_renewing_subscription")};
+
+	/**
+	 * Builds a virtual items response the way the Store API returns it: consumable, non-consumable and subscription items,
+	 * real and virtual prices, promotions, limits, nulls, escaped strings and fields the data model doesn't have.
+	 */
+	TArray<uint8> MakeVirtualItemsResponse(const int32 ItemsCount)
+	{
+		FString Json;
+		Json.Reserve(ItemsCount * 1024);
+		Json += TEXT("{\"has_more\":false,\"items\":[");
+
+		for (int32 Index = 0; Index < ItemsCount; ++Index)
+		{
+			const TCHAR* VirtualItemType = VirtualItemTypes[Index % UE_ARRAY_COUNT(VirtualItemTypes)];
+			const bool bIsConsumable = Index % 3 == 0;
+			const bool bIsSubscription = Index % 3 == 2;
+			const bool bHasVirtualPrice = Index % 4 == 0;
+
+			if (Index > 0)
+			{
+				Json += TEXT(",");
+			}
+
+			Json += FString::Printf(TEXT("{\"item_id\":%d,\"sku\":\"item_%03d\",\"name\":\"Item #%d \\\"%s\\\"\",\"type\":\"virtual_good\","),
+				100000 + Index, Index, Index, VirtualItemType);
+			Json += Index % 2 == 0
+				? TEXT("\"groups\":[{\"external_id\":\"cosmetics\",\"name\":\"Cosmetics \\u00e9dition\"}],")
+				: TEXT("\"groups\":[{\"external_id\":\"potions\",\"name\":\"Potions\"},{\"external_id\":\"weapons\",\"name\":\"Weapons\"}],");
+			Json += Index % 5 == 0
+				? FString::Printf(TEXT("\"attributes\":[{\"external_id\":\"rarity\",\"name\":\"Rarity\",\"values\":[{\"external_id\":\"rarity_%d\",\"value\":\"Common\"}]}],"), Index)
+				: FString(TEXT("\"attributes\":[],"));
+			Json += FString::Printf(TEXT("\"description\":\"Description of item %d.\\nSecond line with \u2728 and \\\\ backslash.\",\"long_description\":%s,"),
+				Index, Index % 2 == 0 ? *FString::Printf(TEXT("\"Long description of item %d\""), Index) : TEXT("null"));
+			Json += TEXT("\"image_url\":\"https://cdn3.xsolla.com/img/misc/merchant/default-item.png\",\"is_free\":false,");
+			Json += bHasVirtualPrice
+				? FString::Printf(TEXT("\"price\":null,\"virtual_prices\":[{\"sku\":\"crystal\",\"name\":\"Crystals\",\"type\":\"virtual_currency\",")
+					TEXT("\"image_url\":\"https://cdn3.xsolla.com/img/misc/images/crystal.png\",\"is_default\":true,\"amount\":%d,\"amount_without_discount\":%d,")
+					TEXT("\"calculated_price\":{\"amount\":\"%d\",\"amount_without_discount\":\"%d\"}}],"), 100 + Index, 100 + Index, 100 + Index, 100 + Index)
+				: FString::Printf(TEXT("\"price\":{\"amount\":\"%d.99\",\"amount_without_discount\":\"%d.99\",\"currency\":\"USD\"},\"virtual_prices\":[],"), Index % 50, Index % 50);
+			Json += FString::Printf(TEXT("\"can_be_bought\":true,\"inventory_options\":{\"consumable\":%s,\"expiration_period\":%s},\"virtual_item_type\":\"%s\","),
+				bIsConsumable ? TEXT("{\"usages_count\":1}") : TEXT("null"), bIsSubscription ? TEXT("{\"type\":\"day\",\"value\":30}") : TEXT("null"), VirtualItemType);
+			Json += Index % 7 == 0
+				? TEXT("\"promotions\":[{\"name\":\"Summer sale\",\"date_start\":\"2024-06-01T00:00:00+03:00\",\"date_end\":\"2024-09-01T00:00:00+03:00\",")
+					TEXT("\"discount\":{\"percent\":\"20.00\",\"value\":null},\"bonus\":[{\"sku\":\"gold\",\"quantity\":10}],\"limits\":{\"per_user\":{\"available\":3,\"total\":3}}}],")
+					TEXT("\"limits\":{\"per_user\":{\"available\":5,\"total\":5,\"recurrent_schedule\":{\"interval_type\":\"daily\",\"reset_next_date\":1718755200}}},")
+				: TEXT("\"promotions\":[],\"limits\":null,");
+			Json += FString::Printf(TEXT("\"periods\":[],\"custom_attributes\":{\"power\":%d,\"tags\":[\"a\",\"b\"],\"nested\":{\"x\":150.0,\"y\":false}},")
+				TEXT("\"media_list\":[],\"order\":%d,\"is_enabled\":true,\"is_show_in_store\":true,\"vp_rewards\":[]}"), Index, Index + 1);
+		}
+
+		Json += TEXT("]}");
+
+		const FTCHARToUTF8 Converter(*Json);
+		return TArray<uint8>(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length());
+	}
+
+	/** Decodes the response the way XsollaUtilsHttpRequestHelper did before the streaming reader. */
+	bool ReadStructWithConverter(const TArray<uint8>& Content, FStoreItemsData& OutData)
+	{
+		const FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Content.GetData()), Content.Num());
+		const FString ResponseString(Converter.Length(), Converter.Get());
+
+		TSharedPtr<FJsonObject> JsonObject;
+		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseString);
+		return FJsonSerializer::Deserialize(Reader, JsonObject)
+			&& FJsonObjectConverter::JsonObjectToUStruct(JsonObject.ToSharedRef(), FStoreItemsData::StaticStruct(), &OutData);
+	}
+
+	bool ReadStructWithReader(const TArray<uint8>& Content, FStoreItemsData& OutData)
+	{
+		return XsollaUtilsJsonStructReader::ReadStruct(Content, FStoreItemsData::StaticStruct(), &OutData);
+	}
+
+	/**
+	 * Forwards to the allocator it replaces and counts allocations made by the measuring thread.
+	 * Other threads may still hold the pointer after it is uninstalled, so the instance is never destroyed.
+	 */
+	class FCountingMalloc : public FMalloc
+	{
+	public:
+		void Install()
+		{
+			check(GMalloc != this);
+			InnerMalloc = GMalloc;
+			OwnerThreadId = FPlatformTLS::GetCurrentThreadId();
+			Allocations = 0;
+			AllocatedBytes = 0;
+			GMalloc = this;
+		}
+
+		void Uninstall()
+		{
+			GMalloc = InnerMalloc;
+		}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			AddAllocation(Count);
+			return InnerMalloc->Malloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			AddAllocation(Count);
+			return InnerMalloc->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override
+		{
+			InnerMalloc->Free(Original);
+		}
+
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+		{
+			return InnerMalloc->QuantizeSize(Count, Alignment);
+		}
+
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+		{
+			return InnerMalloc->GetAllocationSize(Original, SizeOut);
+		}
+
+		virtual bool IsInternallyThreadSafe() const override
+		{
+			return InnerMalloc->IsInternallyThreadSafe();
+		}
+
+		virtual const TCHAR* GetDescriptiveName() override
+		{
+			return InnerMalloc->GetDescriptiveName();
+		}
+
+		int32 Allocations = 0;
+		SIZE_T AllocatedBytes = 0;
+
+	private:
+		void AddAllocation(const SIZE_T Size)
+		{
+			if (FPlatformTLS::GetCurrentThreadId() == OwnerThreadId)
+			{
+				++Allocations;
+				AllocatedBytes += Size;
+			}
+		}
+
+		FMalloc* InnerMalloc = nullptr;
+		uint32 OwnerThreadId = 0;
+	};
+
+	struct FDecodingStats
+	{
+		double Milliseconds = 0.0;
+		int32 Allocations = 0;
+		SIZE_T AllocatedBytes = 0;
+	};
+
+	/** Returns average time and allocations of one decoding. Results vary between machines and runs, so they are only reported. */
+	FDecodingStats MeasureDecoding(const TArray<uint8>& Content, bool (*Decode)(const TArray<uint8>&, FStoreItemsData&))
+	{
+		FDecodingStats Stats;
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < BenchmarkIterations; ++Index)
+		{
+			FStoreItemsData Data;
+			Decode(Content, Data);
+		}
+		Stats.Milliseconds = (FPlatformTime::Seconds() - StartTime) * 1000.0 / BenchmarkIterations;
+
+		// Allocations are counted in a separate run, so counting doesn't affect the time
+		static FCountingMalloc CountingMalloc;
+		{
+			FStoreItemsData Data;
+			CountingMalloc.Install();
+			Decode(Content, Data);
+			CountingMalloc.Uninstall();
+		}
+		Stats.Allocations = CountingMalloc.Allocations;
+		Stats.AllocatedBytes = CountingMalloc.AllocatedBytes;
+
+		return Stats;
+	}
+}
+
+BEGIN_DEFINE_SPEC(FJsonStructReaderSpec, "Xsolla.Store.JsonStructReader",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+	TArray<uint8> Content;
+END_DEFINE_SPEC(FJsonStructReaderSpec)
+
+void FJsonStructReaderSpec::Define()
+{
+	using namespace JsonStructReaderSpec;
+
+	BeforeEach([this]()
+	{
+		if (Content.Num() == 0)
+		{
+			Content = MakeVirtualItemsResponse(FixtureItemsCount);
+		}
+	});
+
+	Describe("ReadStruct", [this]()
+	{
+		It("should decode virtual items response", [this]()
+		{
+			FStoreItemsData Data;
+			if (!TestTrue("Decoded", ReadStructWithReader(Content, Data)) || !TestEqual("Items", Data.Items.Num(), FixtureItemsCount))
+			{
+				return;
+			}
+
+			const FStoreItem& Item = Data.Items[0];
+			TestEqual("SKU", Item.sku, TEXT("item_000"));
+			TestEqual("Name", Item.name, TEXT("Item #0 \"consumable\""));
+			TestEqual("Description", Item.description, TEXT("Description of item 0.\nSecond line with \u2728 and \\ backslash."));
+			TestEqual("Group", Item.groups.Num() > 0 ? Item.groups[0].name : FString(), TEXT("Cosmetics \u00e9dition"));
+			TestEqual("Usages count", Item.inventory_options.consumable.usages_count, 1);
+			TestEqual("Order", Item.order, 1);
+		});
+
+		It("should produce the same structs as FJsonObjectConverter", [this]()
+		{
+			FStoreItemsData ReaderData;
+			FStoreItemsData ConverterData;
+			if (!TestTrue("Decoded with reader", ReadStructWithReader(Content, ReaderData))
+				|| !TestTrue("Decoded with converter", ReadStructWithConverter(Content, ConverterData))
+				|| !TestEqual("Items", ReaderData.Items.Num(), ConverterData.Items.Num()))
+			{
+				return;
+			}
+
+			TestEqual("Has more", ReaderData.has_more, ConverterData.has_more);
+
+			for (int32 Index = 0; Index < ReaderData.Items.Num(); ++Index)
+			{
+				if (!FStoreItem::StaticStruct()->CompareScriptStruct(&ReaderData.Items[Index], &ConverterData.Items[Index], PPF_None))
+				{
+					AddError(FString::Printf(TEXT("Item %s differs"), *ConverterData.Items[Index].sku));
+				}
+			}
+		});
+
+		It("should report decoding time and allocations compared to FJsonObjectConverter", [this]()
+		{
+			const FDecodingStats ConverterStats = MeasureDecoding(Content, &ReadStructWithConverter);
+			const FDecodingStats ReaderStats = MeasureDecoding(Content, &ReadStructWithReader);
+
+			AddInfo(FString::Printf(TEXT("%d bytes: FJsonObjectConverter %.2f ms, %d allocations, %llu bytes allocated"),
+				Content.Num(), ConverterStats.Milliseconds, ConverterStats.Allocations, static_cast<uint64>(ConverterStats.AllocatedBytes)));
+			AddInfo(FString::Printf(TEXT("%d bytes: XsollaUtilsJsonStructReader %.2f ms, %d allocations, %llu bytes allocated"),
+				Content.Num(), ReaderStats.Milliseconds, ReaderStats.Allocations, static_cast<uint64>(ReaderStats.AllocatedBytes)));
+		});
+	});
+}
+
+#endif
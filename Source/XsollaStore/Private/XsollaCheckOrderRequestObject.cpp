@@ -0,0 +1,8 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#include "XsollaCheckOrderRequestObject.h"
+
+void UXsollaCheckOrderRequestObject::OnCheckError(int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage)
+{
+	OnError.ExecuteIfBound(StatusCode, ErrorCode, ErrorMessage);
+}
@@ -14,6 +14,7 @@
 #include "XsollaUtilsHttpRequestHelper.h"
 #include "XsollaStoreDefines.h"
 #include "CentrifugoServiceSubsystem.h"
+#include "XsollaOrderPollingSubsystem.h"
 #include "Engine/GameInstance.h"
 
 void UXsollaOrderCheckObject::Init(const FString& InAccessToken, const int32 InOrderId, bool bShouldStartWithCentrifugo, const FOnOrderCheckSuccess& InOnSuccess, const FOnOrderCheckError& InOnError, int32 InShortPollingLifeTime)
@@ -39,7 +40,9 @@ void UXsollaOrderCheckObject::Destroy()
 {
 	StopCentrifugoTracking();
 	bShortPollingExpired = true;
+	bShortPollingActive = false;
 	GetWorld()->GetTimerManager().ClearTimer(ShortPollingTimerHandle);
+	GetWorld()->GetGameInstance()->GetSubsystem<UXsollaOrderPollingSubsystem>()->RemoveTracker(this);
 
 	UE_LOG(LogXsollaStore, Log, TEXT("Destroy XsollaOrderCheckObject."));
 }
@@ -49,19 +52,30 @@ const FString& UXsollaOrderCheckObject::GetAccessToken() const
 	return AccessToken;
 }
 
-void UXsollaOrderCheckObject::OnConnectionError()
+int32 UXsollaOrderCheckObject::GetOrderId() const
+{
+	return OrderId;
+}
+
+void UXsollaOrderCheckObject::OnConnectionLost()
 {
 	ActivateShortPolling();
 }
 
-void UXsollaOrderCheckObject::OnOrderStatusUpdated(const FOrderStatusData Data)
+void UXsollaOrderCheckObject::OnConnectionRestored()
 {
-	if (Data.status.IsEmpty())
-	{
-		return;
-	}
+	UE_LOG(LogXsollaStore, Log, TEXT("Centrifugo connection restored, stop short polling."));
+	bShortPollingActive = false;
+	GetWorld()->GetTimerManager().ClearTimer(ShortPollingTimerHandle);
+	GetWorld()->GetGameInstance()->GetSubsystem<UXsollaOrderPollingSubsystem>()->RemoveTracker(this);
+
+	// Status could change while the connection was lost
+	ShortPollingCheckOrder();
+}
 
-	if (Data.order_id != OrderId)
+void UXsollaOrderCheckObject::OnOrderStatusUpdated(const FOrderStatusData& Data)
+{
+	if (Data.status.IsEmpty())
 	{
 		return;
 	}
@@ -99,11 +113,6 @@ void UXsollaOrderCheckObject::OnOrderStatusUpdated(const FOrderStatusData Data)
 	}
 }
 
-void UXsollaOrderCheckObject::OnClosed()
-{
-	ActivateShortPolling();
-}
-
 void UXsollaOrderCheckObject::OnShortPollingExpired()
 {
 	UE_LOG(LogXsollaStore, Log, TEXT("Short polling expired."));
@@ -115,9 +124,14 @@ void UXsollaOrderCheckObject::StartCentrifugoTracking()
 	UE_LOG(LogXsollaStore, Log, TEXT("StartCentrifugoTracking"));
 	UCentrifugoServiceSubsystem* CentrifugoServiceSubsystem = GetWorld()->GetGameInstance()->GetSubsystem<UCentrifugoServiceSubsystem>();
 	CentrifugoServiceSubsystem->AddTracker(this);
-	CentrifugoServiceSubsystem->OrderStatusUpdated.AddUObject(this, &UXsollaOrderCheckObject::OnOrderStatusUpdated);
-	CentrifugoServiceSubsystem->Error.AddUObject(this, &UXsollaOrderCheckObject::OnConnectionError);
-	CentrifugoServiceSubsystem->Close.AddUObject(this, &UXsollaOrderCheckObject::OnClosed);
+	CentrifugoServiceSubsystem->ConnectionLost.AddUObject(this, &UXsollaOrderCheckObject::OnConnectionLost);
+	CentrifugoServiceSubsystem->ConnectionRestored.AddUObject(this, &UXsollaOrderCheckObject::OnConnectionRestored);
+
+	// Kept connection may be lost before the tracker is added
+	if (CentrifugoServiceSubsystem->IsConnectionLost())
+	{
+		OnConnectionLost();
+	}
 }
 
 void UXsollaOrderCheckObject::StopCentrifugoTracking()
@@ -125,19 +139,19 @@ void UXsollaOrderCheckObject::StopCentrifugoTracking()
 	UE_LOG(LogXsollaStore, Log, TEXT("StopCentrifugoTracking"));
 	UCentrifugoServiceSubsystem* CentrifugoServiceSubsystem = GetWorld()->GetGameInstance()->GetSubsystem<UCentrifugoServiceSubsystem>();
 	CentrifugoServiceSubsystem->RemoveTracker(this);
-	CentrifugoServiceSubsystem->OrderStatusUpdated.RemoveAll(this);
-	CentrifugoServiceSubsystem->Error.RemoveAll(this);
-	CentrifugoServiceSubsystem->Close.RemoveAll(this);
+	CentrifugoServiceSubsystem->ConnectionLost.RemoveAll(this);
+	CentrifugoServiceSubsystem->ConnectionRestored.RemoveAll(this);
 }
 
 void UXsollaOrderCheckObject::ActivateShortPolling()
 {
-	StopCentrifugoTracking();
+	// Tracker stays subscribed to Centrifugo, so it can switch back to push updates once connection is restored
 	UE_LOG(LogXsollaStore, Log, TEXT("ActivateShortPolling"));
 	if (!GetWorld()->GetTimerManager().IsTimerActive(ShortPollingTimerHandle))
 	{
+		bShortPollingActive = true;
 		GetWorld()->GetTimerManager().SetTimer(ShortPollingTimerHandle, this, &UXsollaOrderCheckObject::OnShortPollingExpired, ShortPollingLifeTime, false);
-		ShortPollingCheckOrder();
+		GetWorld()->GetGameInstance()->GetSubsystem<UXsollaOrderPollingSubsystem>()->AddTracker(this);
 	}
 }
 
@@ -147,30 +161,27 @@ void UXsollaOrderCheckObject::ShortPollingCheckOrder()
 	FOnOrderCheck CheckOrderSuccessCallback;
 	CheckOrderSuccessCallback.BindLambda([this](int32 InOrderId, EXsollaOrderStatus InOrderStatus, FXsollaOrderContent InOrderContent)
 	{
-		if (InOrderStatus == EXsollaOrderStatus::New || InOrderStatus == EXsollaOrderStatus::Paid)
-		{
-			if (bShortPollingExpired)
-			{
-				OnError.ExecuteIfBound(0, 0, TEXT("Short polling expired."));
-			} else
-			{
-				FTimerHandle TimerHandle;
-				FTimerDelegate TimerDelegate;
-				TimerDelegate.BindLambda([&]()
-				{
-					ShortPollingCheckOrder();
-				});
-				GetWorld()->GetTimerManager().SetTimer(TimerHandle, TimerDelegate, 3.0f, false);
-			}
-		}
-
 		if (InOrderStatus == EXsollaOrderStatus::Canceled)
 		{
 			OnError.ExecuteIfBound(0, 0, TEXT("Order canceled."));
+			return;
 		}
 		if (InOrderStatus == EXsollaOrderStatus::Done)
 		{
 			OnSuccess.ExecuteIfBound(OrderId);
+			return;
+		}
+
+		// Order is pending or its status is unknown, either way the next poll has to be scheduled
+		if (bShortPollingActive)
+		{
+			if (bShortPollingExpired)
+			{
+				OnError.ExecuteIfBound(0, 0, TEXT("Short polling expired."));
+			} else
+			{
+				GetWorld()->GetGameInstance()->GetSubsystem<UXsollaOrderPollingSubsystem>()->OnPollCompleted(this, InOrderStatus);
+			}
 		}
 	});
 
@@ -180,9 +191,12 @@ void UXsollaOrderCheckObject::ShortPollingCheckOrder()
 							.SetPathParam(TEXT("OrderId"), OrderId)
 							.Build();
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = XsollaUtilsHttpRequestHelper::CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, AccessToken, FString(), TEXT("STORE"), XSOLLA_STORE_VERSION);
+	static const FString SdkModuleName(TEXT("STORE"));
+	static const FString SdkModuleVersion(XSOLLA_STORE_VERSION);
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = XsollaUtilsHttpRequestHelper::CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, AccessToken, FString(), SdkModuleName, SdkModuleVersion);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaOrderCheckObject::CheckOrder_HttpRequestComplete, CheckOrderSuccessCallback, OnError);
-	HttpRequest->ProcessRequest();
+	// Short polling needs the current order status, not a response reused from the coalescing window
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest, false);
 }
 
 void UXsollaOrderCheckObject::CheckOrder_HttpRequestComplete(
@@ -223,6 +237,25 @@ void UXsollaOrderCheckObject::CheckOrder_HttpRequestComplete(
 		return;
 	}
 
+	// Rate limited polls are retried later instead of failing the order check
+	if (HttpResponse.IsValid() && HttpResponse->GetResponseCode() == EHttpResponseCodes::TooManyRequests && bShortPollingActive && !bShortPollingExpired)
+	{
+		float RetryAfter = 0.f;
+		const FString RetryAfterHeader = HttpResponse->GetHeader(TEXT("Retry-After"));
+		FDateTime RetryDate;
+		if (RetryAfterHeader.IsNumeric())
+		{
+			RetryAfter = FCString::Atof(*RetryAfterHeader);
+		}
+		else if (FDateTime::ParseHttpDate(RetryAfterHeader, RetryDate))
+		{
+			RetryAfter = (RetryDate - FDateTime::UtcNow()).GetTotalSeconds();
+		}
+
+		GetWorld()->GetGameInstance()->GetSubsystem<UXsollaOrderPollingSubsystem>()->OnPollThrottled(this, RetryAfter);
+		return;
+	}
+
 	auto ErrorMessage = OutError.errorMessage.IsEmpty() ? OutError.description : OutError.errorMessage;
 	UE_LOG(LogXsollaStore, Log, TEXT("Order status error: %s"), *ErrorMessage);
 	OnError.ExecuteIfBound(OutError.statusCode, OutError.errorCode, ErrorMessage);
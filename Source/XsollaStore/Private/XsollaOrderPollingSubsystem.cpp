@@ -0,0 +1,165 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#include "XsollaOrderPollingSubsystem.h"
+#include "XsollaOrderCheckObject.h"
+#include "XsollaStoreDefines.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+void UXsollaOrderPollingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	UE_LOG(LogXsollaStore, Log, TEXT("%s: OrderPolling subsystem initialized"), *VA_FUNC_LINE);
+}
+
+void UXsollaOrderPollingSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(TickTimerHandle);
+	}
+
+	Trackers.Empty();
+	PollingEntries.Empty();
+
+	Super::Deinitialize();
+}
+
+void UXsollaOrderPollingSubsystem::AddTracker(UXsollaOrderCheckObject* Tracker)
+{
+	if (PollingEntries.Contains(Tracker))
+	{
+		return;
+	}
+
+	Trackers.Add(Tracker);
+
+	FPollingEntry& Entry = PollingEntries.Add(Tracker);
+	Entry.NextPollTime = FPlatformTime::Seconds();
+	Entry.Interval = InitialInterval;
+
+	ScheduleTick();
+}
+
+void UXsollaOrderPollingSubsystem::RemoveTracker(UXsollaOrderCheckObject* Tracker)
+{
+	if (PollingEntries.Remove(Tracker) == 0)
+	{
+		return;
+	}
+
+	Trackers.Remove(Tracker);
+
+	ScheduleTick();
+}
+
+void UXsollaOrderPollingSubsystem::Expedite()
+{
+	if (PollingEntries.Num() == 0)
+	{
+		return;
+	}
+
+	UE_LOG(LogXsollaStore, Log, TEXT("%s: Expediting polling of %d orders"), *VA_FUNC_LINE, PollingEntries.Num());
+
+	const double Now = FPlatformTime::Seconds();
+	for (auto& Pair : PollingEntries)
+	{
+		Pair.Value.Interval = FastInterval;
+		Pair.Value.NextPollTime = Now;
+	}
+
+	ScheduleTick();
+}
+
+void UXsollaOrderPollingSubsystem::OnPollCompleted(UXsollaOrderCheckObject* Tracker, const EXsollaOrderStatus OrderStatus)
+{
+	FPollingEntry* Entry = PollingEntries.Find(Tracker);
+	if (!Entry)
+	{
+		return;
+	}
+
+	// Paid orders are delivered shortly, while new ones may wait for the user for minutes
+	Entry->Interval = OrderStatus == EXsollaOrderStatus::Paid
+		? FastInterval
+		: FMath::Min(Entry->Interval * BackoffFactor, MaxInterval);
+	Entry->NextPollTime = FPlatformTime::Seconds() + Entry->Interval;
+	Entry->bIsInFlight = false;
+
+	ScheduleTick();
+}
+
+void UXsollaOrderPollingSubsystem::OnPollThrottled(UXsollaOrderCheckObject* Tracker, const float RetryAfter)
+{
+	FPollingEntry* Entry = PollingEntries.Find(Tracker);
+	if (!Entry)
+	{
+		return;
+	}
+
+	const float Delay = RetryAfter > 0.f ? RetryAfter : Entry->Interval;
+	UE_LOG(LogXsollaStore, Warning, TEXT("%s: Order polling is throttled for %.1f s"), *VA_FUNC_LINE, Delay);
+
+	ThrottledUntil = FMath::Max(ThrottledUntil, FPlatformTime::Seconds() + Delay);
+	Entry->NextPollTime = ThrottledUntil;
+	Entry->bIsInFlight = false;
+
+	ScheduleTick();
+}
+
+void UXsollaOrderPollingSubsystem::Tick()
+{
+	const double Now = FPlatformTime::Seconds();
+
+	TArray<UXsollaOrderCheckObject*> DueTrackers;
+	for (auto& Pair : PollingEntries)
+	{
+		FPollingEntry& Entry = Pair.Value;
+		if (!Entry.bIsInFlight && Entry.NextPollTime <= Now + BatchWindow)
+		{
+			Entry.bIsInFlight = true;
+			DueTrackers.Add(Pair.Key);
+		}
+	}
+
+	UE_LOG(LogXsollaStore, Verbose, TEXT("%s: Polling %d orders"), *VA_FUNC_LINE, DueTrackers.Num());
+
+	// Trackers may complete and remove themselves while polling
+	for (UXsollaOrderCheckObject* Tracker : DueTrackers)
+	{
+		if (PollingEntries.Contains(Tracker))
+		{
+			Tracker->ShortPollingCheckOrder();
+		}
+	}
+
+	ScheduleTick();
+}
+
+void UXsollaOrderPollingSubsystem::ScheduleTick()
+{
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+
+	double NextTickTime = TNumericLimits<double>::Max();
+	for (const auto& Pair : PollingEntries)
+	{
+		if (!Pair.Value.bIsInFlight)
+		{
+			NextTickTime = FMath::Min(NextTickTime, Pair.Value.NextPollTime);
+		}
+	}
+
+	if (NextTickTime == TNumericLimits<double>::Max())
+	{
+		TimerManager.ClearTimer(TickTimerHandle);
+		return;
+	}
+
+	NextTickTime = FMath::Max(NextTickTime, ThrottledUntil);
+
+	// Timer with zero delay is cleared instead of being set, so the tick is made on the next frame
+	const float Delay = FMath::Max(static_cast<float>(NextTickTime - FPlatformTime::Seconds()), KINDA_SMALL_NUMBER);
+	TimerManager.SetTimer(TickTimerHandle, this, &UXsollaOrderPollingSubsystem::Tick, Delay, false);
+}
@@ -0,0 +1,77 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "XsollaStoreDataModel.h"
+#include "Engine/EngineTypes.h"
+#include "XsollaOrderPollingSubsystem.generated.h"
+
+class UXsollaOrderCheckObject;
+
+/**
+ * Schedules order status polling for all trackers with a single timer.
+ *
+ * Orders that are due at about the same time are polled in one tick. Polling interval of each order adapts to its status:
+ * it grows while the order stays new and drops once it is paid or the payment UI is closed. When the server
+ * responds with 429, all polling is paused for the time specified in Retry-After.
+ */
+UCLASS(NotBlueprintType)
+class UXsollaOrderPollingSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Begin USubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	// End USubsystem
+
+	/** Starts polling order status of the tracker. The first check is made immediately. */
+	void AddTracker(UXsollaOrderCheckObject* Tracker);
+	void RemoveTracker(UXsollaOrderCheckObject* Tracker);
+
+	/** Polls all orders without delay and at the shortest interval, e.g. after payment UI is closed. */
+	void Expedite();
+
+	/** Must be called by tracker when polled order is still pending or its status is unknown. */
+	void OnPollCompleted(UXsollaOrderCheckObject* Tracker, const EXsollaOrderStatus OrderStatus);
+
+	/** Must be called by tracker when poll was rejected with 429. Pauses polling of all orders. */
+	void OnPollThrottled(UXsollaOrderCheckObject* Tracker, const float RetryAfter);
+
+private:
+	struct FPollingEntry
+	{
+		double NextPollTime = 0.0;
+		float Interval = 0.f;
+		bool bIsInFlight = false;
+	};
+
+	void Tick();
+	void ScheduleTick();
+
+	/** Interval for new trackers. */
+	float InitialInterval = 3.f;
+
+	/** Interval after payment UI is closed or the order is paid. */
+	float FastInterval = 1.f;
+
+	/** Interval is multiplied by this factor while the order stays new, up to the max value. */
+	float BackoffFactor = 1.5f;
+	float MaxInterval = 15.f;
+
+	/** Orders due within this time from the tick are polled in the same tick. */
+	float BatchWindow = 0.5f;
+
+	/** Time until which polling is paused after 429. */
+	double ThrottledUntil = 0.0;
+
+	FTimerHandle TickTimerHandle;
+
+	UPROPERTY()
+	TArray<UXsollaOrderCheckObject*> Trackers;
+
+	TMap<UXsollaOrderCheckObject*, FPollingEntry> PollingEntries;
+};
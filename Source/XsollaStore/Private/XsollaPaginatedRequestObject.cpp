@@ -0,0 +1,8 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#include "XsollaPaginatedRequestObject.h"
+
+void UXsollaPaginatedRequestObject::OnPageError(int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage)
+{
+	OnError.ExecuteIfBound(StatusCode, ErrorCode, ErrorMessage);
+}
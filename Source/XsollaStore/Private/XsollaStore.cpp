@@ -2,7 +2,10 @@
 
 #include "XsollaStore.h"
 
+#include "XsollaCentrifugoDataModel.h"
+#include "XsollaStoreDataModel.h"
 #include "XsollaStoreDefines.h"
+#include "XsollaUtilsJsonStructDecoder.h"
 
 #include "Developer/Settings/Public/ISettingsModule.h"
 
@@ -10,18 +13,114 @@
 
 const FName FXsollaStoreModule::ModuleName = "XsollaStore";
 
+namespace
+{
+	/** Catalog items and Centrifugo pushes are the most frequently decoded structs, so they skip per-field reflection. */
+	void RegisterDataModelDecoders()
+	{
+		TXsollaJsonStructDecoder<FStoreItem>()
+			.Field("sku", &FStoreItem::sku)
+			.Field("name", &FStoreItem::name)
+			.Field("description", &FStoreItem::description)
+			.Field("type", &FStoreItem::type)
+			.Field("virtual_item_type", &FStoreItem::virtual_item_type)
+			.Field("groups", &FStoreItem::groups)
+			.Field("is_free", &FStoreItem::is_free)
+			.Field("price", &FStoreItem::price)
+			.Field("virtual_prices", &FStoreItem::virtual_prices)
+			.Field("image_url", &FStoreItem::image_url)
+			.Field("inventory_options", &FStoreItem::inventory_options)
+			.Field("bundle_type", &FStoreItem::bundle_type)
+			.Field("total_content_price", &FStoreItem::total_content_price)
+			.Field("content", &FStoreItem::content)
+			.Field("attributes", &FStoreItem::attributes)
+			.Field("long_description", &FStoreItem::long_description)
+			.Field("order", &FStoreItem::order)
+			.Field("media_list", &FStoreItem::media_list)
+			.Field("promotions", &FStoreItem::promotions)
+			.Field("limits", &FStoreItem::limits)
+			.Register();
+
+		TXsollaJsonStructDecoder<FVirtualCurrencyPackage>()
+			.Field("sku", &FVirtualCurrencyPackage::sku)
+			.Field("name", &FVirtualCurrencyPackage::name)
+			.Field("type", &FVirtualCurrencyPackage::type)
+			.Field("description", &FVirtualCurrencyPackage::description)
+			.Field("image_url", &FVirtualCurrencyPackage::image_url)
+			.Field("attributes", &FVirtualCurrencyPackage::attributes)
+			.Field("groups", &FVirtualCurrencyPackage::groups)
+			.Field("bundle_type", &FVirtualCurrencyPackage::bundle_type)
+			.Field("is_free", &FVirtualCurrencyPackage::is_free)
+			.Field("price", &FVirtualCurrencyPackage::price)
+			.Field("virtual_prices", &FVirtualCurrencyPackage::virtual_prices)
+			.Field("content", &FVirtualCurrencyPackage::content)
+			.Field("long_description", &FVirtualCurrencyPackage::long_description)
+			.Field("order", &FVirtualCurrencyPackage::order)
+			.Field("media_list", &FVirtualCurrencyPackage::media_list)
+			.Field("promotions", &FVirtualCurrencyPackage::promotions)
+			.Field("limits", &FVirtualCurrencyPackage::limits)
+			.Register();
+
+		TXsollaJsonStructDecoder<FStoreBundle>()
+			.Field("sku", &FStoreBundle::sku)
+			.Field("name", &FStoreBundle::name)
+			.Field("groups", &FStoreBundle::groups)
+			.Field("attributes", &FStoreBundle::attributes)
+			.Field("type", &FStoreBundle::type)
+			.Field("bundle_type", &FStoreBundle::bundle_type)
+			.Field("description", &FStoreBundle::description)
+			.Field("image_url", &FStoreBundle::image_url)
+			.Field("is_free", &FStoreBundle::is_free)
+			.Field("price", &FStoreBundle::price)
+			.Field("total_content_price", &FStoreBundle::total_content_price)
+			.Field("virtual_prices", &FStoreBundle::virtual_prices)
+			.Field("content", &FStoreBundle::content)
+			.Field("promotions", &FStoreBundle::promotions)
+			.Field("limits", &FStoreBundle::limits)
+			.Register();
+
+		TXsollaJsonStructDecoder<FOrderStatusData>()
+			.Field("order_id", &FOrderStatusData::order_id)
+			.Field("status", &FOrderStatusData::status)
+			.Register();
+
+		TXsollaJsonStructDecoder<FOrderStatusPub>()
+			.Field("data", &FOrderStatusPub::data)
+			.Field("offset", &FOrderStatusPub::offset)
+			.Register();
+
+		TXsollaJsonStructDecoder<FOrderStatusPush>()
+			.Field("pub", &FOrderStatusPush::pub)
+			.Field("channel", &FOrderStatusPush::channel)
+			.Register();
+	}
+
+	void UnregisterDataModelDecoders()
+	{
+		TXsollaJsonStructDecoder<FStoreItem>::Unregister();
+		TXsollaJsonStructDecoder<FVirtualCurrencyPackage>::Unregister();
+		TXsollaJsonStructDecoder<FStoreBundle>::Unregister();
+		TXsollaJsonStructDecoder<FOrderStatusData>::Unregister();
+		TXsollaJsonStructDecoder<FOrderStatusPub>::Unregister();
+		TXsollaJsonStructDecoder<FOrderStatusPush>::Unregister();
+	}
+}
+
 void FXsollaStoreModule::StartupModule()
 {
 	if (!FModuleManager::Get().IsModuleLoaded("WebSockets"))
 	{
 		FModuleManager::Get().LoadModule("WebSockets");
 	}
-	
+
+	RegisterDataModelDecoders();
+
 	UE_LOG(LogXsollaStore, Log, TEXT("%s: XsollaStore module started"), *VA_FUNC_LINE);
 }
 
 void FXsollaStoreModule::ShutdownModule()
 {
+	UnregisterDataModelDecoders();
 }
 #undef LOCTEXT_NAMESPACE
 
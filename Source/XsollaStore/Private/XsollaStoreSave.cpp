@@ -1,14 +1,23 @@
 // Copyright 2024 Xsolla Inc. All Rights Reserved.
 
 #include "XsollaStoreSave.h"
+#include "XsollaUtilsSaveWriter.h"
 
 #include "Kismet/GameplayStatics.h"
 
 const FString UXsollaStoreSave::SaveSlotName = "XsollaStoreSaveSlot";
+const FString UXsollaStoreSave::PurchaseJournalSlotName = "XsollaPurchaseJournalSlot";
 const int32 UXsollaStoreSave::UserIndex = 0;
+const int64 UXsollaStoreSave::PendingPurchaseMaxAge = 24 * 60 * 60;
+
+FString UXsollaStoreSave::PurchaseJournal;
+bool UXsollaStoreSave::bIsPurchaseJournalLoaded = false;
 
 FXsollaStoreSaveData UXsollaStoreSave::Load()
 {
+	// Pending data is newer than the slot content
+	XsollaUtilsSaveWriter::Get().Flush();
+
 	if (!UGameplayStatics::DoesSaveGameExist(SaveSlotName, UserIndex))
 	{
 		return FXsollaStoreSaveData();
@@ -25,13 +34,153 @@ FXsollaStoreSaveData UXsollaStoreSave::Load()
 
 void UXsollaStoreSave::Save(const FXsollaStoreSaveData& InCartData)
 {
-	auto SaveInstance = Cast<UXsollaStoreSave>(UGameplayStatics::LoadGameFromSlot(UXsollaStoreSave::SaveSlotName, UXsollaStoreSave::UserIndex));
-	if (!SaveInstance)
+	// Cart changes in quick succession are written once, without reading the slot back
+	XsollaUtilsSaveWriter::Get().ScheduleSave(SaveSlotName, UserIndex, nullptr,
+		[InCartData]() -> USaveGame*
+		{
+			UXsollaStoreSave* SaveInstance = Cast<UXsollaStoreSave>(UGameplayStatics::CreateSaveGameObject(StaticClass()));
+			SaveInstance->CartData = InCartData;
+			return SaveInstance;
+		});
+}
+
+void UXsollaStoreSave::AppendPurchaseRecord(const FXsollaPurchaseJournalRecord& Record)
+{
+	LoadPurchaseJournal();
+
+	PurchaseJournal += FormatPurchaseRecord(Record);
+
+	// Created order is lost if the app is killed within the coalescing window, so it isn't delayed
+	SavePurchaseJournal(Record.State == EXsollaPurchaseJournalState::Created);
+}
+
+TArray<FXsollaPurchaseJournalRecord> UXsollaStoreSave::LoadPendingPurchases()
+{
+	LoadPurchaseJournal();
+
+	TArray<FString> Lines;
+	PurchaseJournal.ParseIntoArrayLines(Lines);
+
+	TMap<int32, FXsollaPurchaseJournalRecord> Purchases;
+	for (const FString& Line : Lines)
+	{
+		// Slot writes aren't atomic on every platform, a record may be incomplete if the app was killed while writing it
+		FXsollaPurchaseJournalRecord Record;
+		if (!ParsePurchaseRecord(Line, Record))
+		{
+			continue;
+		}
+
+		// Later records override the state, while SKU and token kind are kept from the records that have them.
+		// Time of the first record is kept, so the age of the purchase isn't reset by tracking it again.
+		FXsollaPurchaseJournalRecord* Purchase = Purchases.Find(Record.OrderId);
+		if (!Purchase)
+		{
+			Purchases.Add(Record.OrderId, Record);
+			continue;
+		}
+
+		Purchase->State = Record.State;
+		if (!Record.Sku.IsEmpty())
+		{
+			Purchase->Sku = Record.Sku;
+		}
+		if (!Record.TokenRef.IsEmpty())
+		{
+			Purchase->TokenRef = Record.TokenRef;
+		}
+	}
+
+	TArray<FXsollaPurchaseJournalRecord> PendingPurchases;
+	for (const auto& Pair : Purchases)
+	{
+		if (Pair.Value.IsPending())
+		{
+			PendingPurchases.Add(Pair.Value);
+		}
+	}
+
+	return PendingPurchases;
+}
+
+void UXsollaStoreSave::CompactPurchaseJournal(const TArray<FXsollaPurchaseJournalRecord>& Records)
+{
+	PurchaseJournal.Reset();
+	for (const FXsollaPurchaseJournalRecord& Record : Records)
+	{
+		PurchaseJournal += FormatPurchaseRecord(Record);
+	}
+
+	bIsPurchaseJournalLoaded = true;
+	SavePurchaseJournal();
+}
+
+void UXsollaStoreSave::LoadPurchaseJournal()
+{
+	if (bIsPurchaseJournalLoaded)
+	{
+		return;
+	}
+
+	bIsPurchaseJournalLoaded = true;
+
+	TArray<uint8> Data;
+	if (!UGameplayStatics::DoesSaveGameExist(PurchaseJournalSlotName, UserIndex) || !UGameplayStatics::LoadDataFromSlot(Data, PurchaseJournalSlotName, UserIndex))
+	{
+		return;
+	}
+
+	PurchaseJournal = FString(Data.Num(), reinterpret_cast<const UTF8CHAR*>(Data.GetData()));
+
+	// Incomplete record left by an interrupted write is dropped, so appended records start on a new line
+	int32 LastLineEnd = INDEX_NONE;
+	PurchaseJournal.FindLastChar(TEXT('\n'), LastLineEnd);
+	PurchaseJournal.LeftInline(LastLineEnd + 1);
+}
+
+void UXsollaStoreSave::SavePurchaseJournal(const bool bWriteNow)
+{
+	// Text is converted and written on a worker thread, writes of several transitions in quick succession are coalesced
+	XsollaUtilsSaveWriter::Get().ScheduleDataSave(PurchaseJournalSlotName, UserIndex,
+		[Text = PurchaseJournal](TArray<uint8>& OutData)
+		{
+			const FTCHARToUTF8 Utf8Text(*Text);
+			OutData.Append(reinterpret_cast<const uint8*>(Utf8Text.Get()), Utf8Text.Length());
+		},
+		bWriteNow);
+}
+
+FString UXsollaStoreSave::FormatPurchaseRecord(const FXsollaPurchaseJournalRecord& Record)
+{
+	// Terminator marks complete records
+	return FString::Printf(TEXT("%d\t%d\t%s\t%lld\t%s;\n"),
+		Record.OrderId, static_cast<int32>(Record.State), *Record.TokenRef, Record.Timestamp, *Record.Sku);
+}
+
+bool UXsollaStoreSave::ParsePurchaseRecord(const FString& Line, FXsollaPurchaseJournalRecord& OutRecord)
+{
+	if (!Line.EndsWith(TEXT(";")))
+	{
+		return false;
+	}
+
+	TArray<FString> Fields;
+	Line.LeftChop(1).ParseIntoArray(Fields, TEXT("\t"), false);
+	if (Fields.Num() < 4 || Fields.Num() > 5 || !Fields[0].IsNumeric() || !Fields[1].IsNumeric())
 	{
-		SaveInstance = Cast<UXsollaStoreSave>(UGameplayStatics::CreateSaveGameObject(UXsollaStoreSave::StaticClass()));
+		return false;
 	}
 
-	SaveInstance->CartData = InCartData;
+	const int32 State = FCString::Atoi(*Fields[1]);
+	if (State < 0 || State > static_cast<int32>(EXsollaPurchaseJournalState::Canceled))
+	{
+		return false;
+	}
 
-	UGameplayStatics::SaveGameToSlot(SaveInstance, UXsollaStoreSave::SaveSlotName, 0);
+	OutRecord.OrderId = FCString::Atoi(*Fields[0]);
+	OutRecord.State = static_cast<EXsollaPurchaseJournalState>(State);
+	OutRecord.TokenRef = Fields[2];
+	OutRecord.Timestamp = FCString::Atoi64(*Fields[3]);
+	OutRecord.Sku = Fields.Num() == 5 ? Fields[4] : FString();
+	return OutRecord.OrderId > 0;
 }
@@ -6,6 +6,7 @@
 #include "XsollaStoreDataModel.h"
 #include "XsollaStoreDefines.h"
 #include "XsollaStoreSave.h"
+#include "XsollaUtilsHttpCache.h"
 #include "XsollaUtilsLibrary.h"
 #include "XsollaUtilsTokenParser.h"
 #include "XsollaUtilsUrlBuilder.h"
@@ -21,6 +22,8 @@
 #include "Serialization/JsonWriter.h"
 #include "UObject/ConstructorHelpers.h"
 #include "XsollaOrderCheckObject.h"
+#include "XsollaOrderPollingSubsystem.h"
+#include "CentrifugoServiceSubsystem.h"
 #include "XsollaSettingsModule.h"
 #include "XsollaProjectSettings.h"
 #include "Engine/World.h"
@@ -70,10 +73,15 @@ void UXsollaStoreSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	const UXsollaProjectSettings* Settings = FXsollaSettingsModule::Get().GetSettings();
 	Initialize(Settings->ProjectID);
 
-	LoginSubsystem = GetGameInstance()->GetSubsystem<UXsollaLoginSubsystem>();
+	XsollaUtilsHttpCache::Get().SetEnabled(Settings->CacheCatalogResponses);
+
+	// Saved user token is needed to resume pending purchases
+	LoginSubsystem = Collection.InitializeDependency<UXsollaLoginSubsystem>();
 
 	UE_LOG(LogXsollaStore, Log, TEXT("%s: XsollaStore subsystem initialized"), *VA_FUNC_LINE);
 
+	ResumePendingPurchases();
+
 	FString Engine = FString::Printf(TEXT("ue%d"), FEngineVersion::Current().GetMajor());
 	FString EngineVersion = ENGINE_VERSION_STRING;
 
@@ -102,30 +110,68 @@ void UXsollaStoreSubsystem::Deinitialize()
 
 void UXsollaStoreSubsystem::Initialize(const FString& InProjectId)
 {
+	if (ProjectID != InProjectId)
+	{
+		// Catalog of another project doesn't diff against the new one
+		ResetCatalog();
+	}
+
 	ProjectID = InProjectId;
 }
 
+void UXsollaStoreSubsystem::SetCatalogQuery(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields)
+{
+	const FString QueryKey = GetCatalogQueryKey(Locale, Country, AdditionalFields);
+	if (bHasCatalogQuery && CatalogQueryKey == QueryKey)
+	{
+		return;
+	}
+
+	// Catalog of another locale or country doesn't diff against the new one
+	ResetCatalog();
+	CatalogQueryKey = QueryKey;
+	bHasCatalogQuery = true;
+}
+
+const FStoreItemsData& UXsollaStoreSubsystem::GetCatalogVirtualItems() const
+{
+	return CatalogVirtualItems;
+}
+
+const FVirtualCurrencyData& UXsollaStoreSubsystem::GetCatalogVirtualCurrencies() const
+{
+	return CatalogVirtualCurrencies;
+}
+
+const FVirtualCurrencyPackagesData& UXsollaStoreSubsystem::GetCatalogVirtualCurrencyPackages() const
+{
+	return CatalogVirtualCurrencyPackages;
+}
+
+const FStoreListOfBundles& UXsollaStoreSubsystem::GetCatalogBundles() const
+{
+	return CatalogBundles;
+}
+
+void UXsollaStoreSubsystem::ClearCatalogCache()
+{
+	XsollaUtilsHttpCache::Get().Clear();
+}
+
 void UXsollaStoreSubsystem::GetPaginatedVirtualItems(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnStoreItemsUpdate& SuccessCallback, const FOnError& ErrorCallback,
 	const int Limit, const int Offset, const FString& AuthToken)
 {
-
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/virtual_items"))
-							.SetPathParam(TEXT("ProjectID"), ProjectID)
-							.AddStringQueryParam(TEXT("locale"), Locale)
-							.AddStringQueryParam(TEXT("country"), Country)
-							.AddArrayQueryParam(TEXT("additional_fields[]"), AdditionalFields)
-							.AddNumberQueryParam(TEXT("limit"), Limit)
-							.AddNumberQueryParam(TEXT("offset"), Offset)
-							.Build();
+	const FString Url = GetVirtualItemsUrl(Locale, Country, AdditionalFields, Limit, Offset);
 
 	FOnTokenUpdate SuccessTokenUpdate;
 	SuccessTokenUpdate.BindLambda([&, Url, SuccessCallback, ErrorCallback, SuccessTokenUpdate](const FString& Token, bool bRepeatOnError)
 	{
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
+		XsollaUtilsHttpRequestHelper::EnableResponseCache(HttpRequest);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::GetVirtualItems_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -134,73 +180,74 @@ void UXsollaStoreSubsystem::GetPaginatedVirtualItems(const FString& Locale, cons
 void UXsollaStoreSubsystem::GetVirtualItems(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnStoreItemsUpdate& SuccessCallback, const FOnError& ErrorCallback, const FString& AuthToken)
 {
-	GetAllVirtualItemsParams = FGetAllVirtualItemsParams(Locale, Country, AdditionalFields, SuccessCallback, ErrorCallback, AuthToken);
-	GetAllVirtualItemsParams.CurrentSuccessCallback.BindDynamic(this, &UXsollaStoreSubsystem::GetVirtualItemsCallback);
-	GetAllVirtualItemsParams.CurrentErrorCallback.BindDynamic(this, &UXsollaStoreSubsystem::GetVirtualItemsError);
-	CallGetVirtualItems();
+	StartPaginatedRequest<FGetAllVirtualItemsParams, FStoreItemsData>(GetAllVirtualItemsRequests,
+		FGetAllVirtualItemsParams(Locale, Country, AdditionalFields, SuccessCallback, ErrorCallback, AuthToken),
+		[this](const FGetAllVirtualItemsParams& Params, int32 PageOffset)
+		{
+			return GetVirtualItemsUrl(Params.Locale, Params.Country, Params.AdditionalFields, Params.Limit, PageOffset);
+		},
+		[this](const FString& QueryKey, const FGetAllVirtualItemsParams& Params)
+		{
+			UpdateCatalog(QueryKey, Params.ResultData);
+		});
 }
 
 void UXsollaStoreSubsystem::GetItemGroups(const FString& PromoCode,
 	const FOnItemGroupsUpdate& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/groups"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/groups"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.AddStringQueryParam(TEXT("promo_code"), PromoCode)
 							.Build();
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET);
+	XsollaUtilsHttpRequestHelper::EnableResponseCache(HttpRequest);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this,
 		&UXsollaStoreSubsystem::GetItemGroups_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaStoreSubsystem::GetPaginatedVirtualCurrencies(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnVirtualCurrenciesUpdate& SuccessCallback, const FOnError& ErrorCallback, const int Limit, const int Offset)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectId}/items/virtual_currency"))
-							.SetPathParam(TEXT("ProjectId"), ProjectID)
-							.AddStringQueryParam(TEXT("locale"), Locale)
-							.AddStringQueryParam(TEXT("country"), Country)
-							.AddNumberQueryParam(TEXT("limit"), Limit)
-							.AddNumberQueryParam(TEXT("offset"), Offset)
-							.AddArrayQueryParam(TEXT("additional_fields[]"), AdditionalFields)
-							.Build();
+	const FString Url = GetVirtualCurrenciesUrl(Locale, Country, AdditionalFields, Limit, Offset);
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET);
+	XsollaUtilsHttpRequestHelper::EnableResponseCache(HttpRequest);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this,
 		&UXsollaStoreSubsystem::GetVirtualCurrencies_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaStoreSubsystem::GetVirtualCurrencies(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnVirtualCurrenciesUpdate& SuccessCallback, const FOnError& ErrorCallback)
 {
-	GetAllVirtualCurrenciesParams = FGetAllVirtualCurrenciesParams(Locale, Country, AdditionalFields, SuccessCallback, ErrorCallback);
-
-	GetAllVirtualCurrenciesParams.CurrentSuccessCallback.BindDynamic(this, &UXsollaStoreSubsystem::GetVirtualCurrenciesCallback);
-	GetAllVirtualCurrenciesParams.CurrentErrorCallback.BindDynamic(this, &UXsollaStoreSubsystem::GetVirtualCurrenciesError);
-	CallGetVirtualCurrencies();
+	StartPaginatedRequest<FGetAllVirtualCurrenciesParams, FVirtualCurrencyData>(GetAllVirtualCurrenciesRequests,
+		FGetAllVirtualCurrenciesParams(Locale, Country, AdditionalFields, SuccessCallback, ErrorCallback),
+		[this](const FGetAllVirtualCurrenciesParams& Params, int32 PageOffset)
+		{
+			return GetVirtualCurrenciesUrl(Params.Locale, Params.Country, Params.AdditionalFields, Params.Limit, PageOffset);
+		},
+		[this](const FString& QueryKey, const FGetAllVirtualCurrenciesParams& Params)
+		{
+			UpdateCatalog(QueryKey, Params.ResultData);
+		});
 }
 
 void UXsollaStoreSubsystem::GetPaginatedVirtualCurrencyPackages(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnVirtualCurrencyPackagesUpdate& SuccessCallback, const FOnError& ErrorCallback, const int Limit, const int Offset, const FString& AuthToken)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/virtual_currency/package"))
-							.SetPathParam(TEXT("ProjectID"), ProjectID)
-							.AddStringQueryParam(TEXT("locale"), Locale)
-							.AddStringQueryParam(TEXT("country"), Country)
-							.AddArrayQueryParam(TEXT("additional_fields[]"), AdditionalFields)
-							.AddNumberQueryParam(TEXT("limit"), Limit)
-							.AddNumberQueryParam(TEXT("offset"), Offset)
-							.Build();
+	const FString Url = GetVirtualCurrencyPackagesUrl(Locale, Country, AdditionalFields, Limit, Offset);
 
 	FOnTokenUpdate SuccessTokenUpdate;
 	SuccessTokenUpdate.BindLambda([&, Url, SuccessCallback, ErrorCallback, SuccessTokenUpdate](const FString& Token, bool bRepeatOnError)
 	{
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
+		XsollaUtilsHttpRequestHelper::EnableResponseCache(HttpRequest);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::GetVirtualCurrencyPackages_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -209,33 +256,31 @@ void UXsollaStoreSubsystem::GetPaginatedVirtualCurrencyPackages(const FString& L
 void UXsollaStoreSubsystem::GetVirtualCurrencyPackages(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnVirtualCurrencyPackagesUpdate& SuccessCallback, const FOnError& ErrorCallback, const FString& AuthToken)
 {
-	GetAllVirtualCurrencyPackagesParams = FGetAllVirtualCurrencyPackagesParams(Locale, Country, AdditionalFields, SuccessCallback, ErrorCallback, AuthToken);
-
-	GetAllVirtualCurrencyPackagesParams.CurrentSuccessCallback.BindDynamic(this, &UXsollaStoreSubsystem::GetVirtualCurrencyPackagesCallback);
-	GetAllVirtualCurrencyPackagesParams.CurrentErrorCallback.BindDynamic(this, &UXsollaStoreSubsystem::GetVirtualCurrencyPackagesError);
-	CallGetVirtualCurrencyPackages();
+	StartPaginatedRequest<FGetAllVirtualCurrencyPackagesParams, FVirtualCurrencyPackagesData>(GetAllVirtualCurrencyPackagesRequests,
+		FGetAllVirtualCurrencyPackagesParams(Locale, Country, AdditionalFields, SuccessCallback, ErrorCallback, AuthToken),
+		[this](const FGetAllVirtualCurrencyPackagesParams& Params, int32 PageOffset)
+		{
+			return GetVirtualCurrencyPackagesUrl(Params.Locale, Params.Country, Params.AdditionalFields, Params.Limit, PageOffset);
+		},
+		[this](const FString& QueryKey, const FGetAllVirtualCurrencyPackagesParams& Params)
+		{
+			UpdateCatalog(QueryKey, Params.ResultData);
+		});
 }
 
 void UXsollaStoreSubsystem::GetPaginatedItemsListBySpecifiedGroup(const FString& ExternalId, const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnGetItemsListBySpecifiedGroup& SuccessCallback, const FOnError& ErrorCallback, const int Limit, const int Offset, const FString& AuthToken)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/virtual_items/group/{ExternalId}"))
-							.SetPathParam(TEXT("ProjectID"), ProjectID)
-							.SetPathParam(TEXT("ExternalId"), ExternalId.IsEmpty() ? TEXT("all") : ExternalId)
-							.AddStringQueryParam(TEXT("locale"), Locale)
-							.AddStringQueryParam(TEXT("country"), Country)
-							.AddArrayQueryParam(TEXT("additional_fields[]"), AdditionalFields)
-							.AddNumberQueryParam(TEXT("limit"), Limit)
-							.AddNumberQueryParam(TEXT("offset"), Offset)
-							.Build();
+	const FString Url = GetItemsListBySpecifiedGroupUrl(ExternalId, Locale, Country, AdditionalFields, Limit, Offset);
 
 	FOnTokenUpdate SuccessTokenUpdate;
 	SuccessTokenUpdate.BindLambda([&, Url, SuccessCallback, ErrorCallback, SuccessTokenUpdate](const FString& Token, bool bRepeatOnError)
 	{
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
+		XsollaUtilsHttpRequestHelper::EnableResponseCache(HttpRequest);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::GetItemsListBySpecifiedGroup_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -244,16 +289,18 @@ void UXsollaStoreSubsystem::GetPaginatedItemsListBySpecifiedGroup(const FString&
 void UXsollaStoreSubsystem::GetItemsListBySpecifiedGroup(const FString& ExternalId, const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnGetItemsListBySpecifiedGroup& SuccessCallback, const FOnError& ErrorCallback, const FString& AuthToken)
 {
-	GetAllItemsListBySpecifiedGroupParams = FGetAllItemsListBySpecifiedGroupParams(ExternalId, Locale, Country, AdditionalFields, SuccessCallback, ErrorCallback, AuthToken);
-
-	GetAllItemsListBySpecifiedGroupParams.CurrentSuccessCallback.BindDynamic(this, &UXsollaStoreSubsystem::GetAllItemsListBySpecifiedGroupCallback);
-	GetAllItemsListBySpecifiedGroupParams.CurrentErrorCallback.BindDynamic(this, &UXsollaStoreSubsystem::GetAllItemsListBySpecifiedGroupError);
-	CallGetAllItemsListBySpecifiedGroup();
+	StartPaginatedRequest<FGetAllItemsListBySpecifiedGroupParams, FStoreItemsList>(GetAllItemsListBySpecifiedGroupRequests,
+		FGetAllItemsListBySpecifiedGroupParams(ExternalId, Locale, Country, AdditionalFields, SuccessCallback, ErrorCallback, AuthToken),
+		[this](const FGetAllItemsListBySpecifiedGroupParams& Params, int32 PageOffset)
+		{
+			return GetItemsListBySpecifiedGroupUrl(Params.ExternalId, Params.Locale, Params.Country, Params.AdditionalFields, Params.Limit, PageOffset);
+		});
 }
 
 void UXsollaStoreSubsystem::GetAllItemsList(const FString& Locale, const FOnGetItemsList& SuccessCallback, const FOnError& ErrorCallback, const FString& AuthToken)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/virtual_items/all"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/virtual_items/all"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.AddStringQueryParam(TEXT("locale"), Locale)
 							.Build();
@@ -264,7 +311,7 @@ void UXsollaStoreSubsystem::GetAllItemsList(const FString& Locale, const FOnGetI
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::GetAllItemsList_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -277,7 +324,8 @@ void UXsollaStoreSubsystem::FetchPaymentToken(const FString& AuthToken, const FS
 
 	RequestDataJson->SetNumberField(TEXT("quantity"), PurchaseParams.Quantity);
 
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/payment/item/{ItemSKU}"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/payment/item/{ItemSKU}"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("ItemSKU"), ItemSKU)
 							.Build();
@@ -304,7 +352,7 @@ void UXsollaStoreSubsystem::FetchPaymentToken(const FString& AuthToken, const FS
 		}
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::FetchPaymentToken_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -317,11 +365,13 @@ void UXsollaStoreSubsystem::FetchCartPaymentToken(const FString& AuthToken, cons
 
 	TSharedPtr<FJsonObject> RequestDataJson = PreparePaymentTokenRequestPayload(PurchaseParams);
 
-	const FString Endpoint = CartId.IsEmpty()
-								 ? TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/payment/cart")
-								 : TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/payment/cart/{CartID}");
+	static const XsollaUtilsUrlTemplate CurrentCartUrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/payment/cart"));
+	static const XsollaUtilsUrlTemplate CartUrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/payment/cart/{CartID}"));
+	const XsollaUtilsUrlTemplate& UrlTemplate = CartId.IsEmpty()
+								 ? CurrentCartUrlTemplate
+								 : CartUrlTemplate;
 
-	const FString Url = XsollaUtilsUrlBuilder(Endpoint)
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("CartID"), CartId)
 							.Build();
@@ -348,7 +398,7 @@ void UXsollaStoreSubsystem::FetchCartPaymentToken(const FString& AuthToken, cons
 		}
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::FetchPaymentToken_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -364,7 +414,9 @@ void UXsollaStoreSubsystem::LaunchPaymentConsole(UObject* WorldContextObject, co
 	FString EngineVersion = ENGINE_VERSION_STRING;
 
 	const bool bUseSteamOverlayForDesktop = CachedPaymentTokenRequestPayload.bUseSteamOverlayForDesktop;
-	const FString PaystationUrl = XsollaUtilsUrlBuilder(IsSandboxEnabled() ? TEXT("https://sandbox-secure.xsolla.com/{PayStationVersion}") : TEXT("https://secure.xsolla.com/{PayStationVersion}"))
+	static const XsollaUtilsUrlTemplate SandboxPaystationUrlTemplate(TEXT("https://sandbox-secure.xsolla.com/{PayStationVersion}"));
+	static const XsollaUtilsUrlTemplate PaystationUrlTemplate(TEXT("https://secure.xsolla.com/{PayStationVersion}"));
+	const FString PaystationUrl = XsollaUtilsUrlBuilder(IsSandboxEnabled() ? SandboxPaystationUrlTemplate : PaystationUrlTemplate)
 							.SetPathParam(TEXT("PayStationVersion"), GetPayStationVersionPath(PayStationVersion))
 							.AddStringQueryParam(GetTokenQueryParameterName(PayStationVersion), AccessToken)
 							.AddStringQueryParam(TEXT("engine"), Engine)
@@ -410,7 +462,9 @@ void UXsollaStoreSubsystem::LaunchPaymentConsole(UObject* WorldContextObject, co
 		int32 PayStationVersionNumber = PayStationVersion == EXsollaPayStationVersion::v3 ? 3 : 4;
 		FString RedirectURI = FString::Printf(TEXT("xpayment.%s"), *UXsollaLoginLibrary::GetAppId());
 		UXsollaNativePaymentsCallback* nativeCallback = NewObject<UXsollaNativePaymentsCallback>();
-		nativeCallback->BindBrowserClosedDelegate(BrowserClosedCallback);
+		FOnStoreBrowserClosed NativeBrowserClosedCallback;
+		NativeBrowserClosedCallback.BindDynamic(this, &UXsollaStoreSubsystem::BrowserClosedCallback);
+		nativeCallback->BindBrowserClosedDelegate(NativeBrowserClosedCallback);
 
 		XsollaMethodCallUtils::CallStaticVoidMethod("com/xsolla/store/XsollaNativePayments", "openPurchaseUI",
 			"(Landroid/app/Activity;Ljava/lang/String;ZLjava/lang/String;Ljava/lang/String;IJ)V",
@@ -440,8 +494,7 @@ void UXsollaStoreSubsystem::LaunchPaymentConsole(UObject* WorldContextObject, co
 					bool isManually = (error != nil) && ([@(error.code) integerValue] == NSError.cancelledByUserError);
 					AsyncTask(ENamedThreads::GameThread, [=]()
 					{
-						PaymentBrowserClosedCallback.ExecuteIfBound(isManually);
-						PaymentBrowserClosedCallback.Unbind();
+						OnPaymentBrowserClosed(isManually);
 					});
 			}];
 		});
@@ -451,8 +504,7 @@ void UXsollaStoreSubsystem::LaunchPaymentConsole(UObject* WorldContextObject, co
 		MyBrowser = CreateWidget<UXsollaStoreBrowserWrapper>(WorldContextObject->GetWorld(), DefaultBrowserWidgetClass);
 		MyBrowser->OnBrowserClosed.BindLambda([&](bool bIsManually)
 		{
-			PaymentBrowserClosedCallback.ExecuteIfBound(bIsManually);
-			PaymentBrowserClosedCallback.Unbind();
+			OnPaymentBrowserClosed(bIsManually);
 		});
 		MyBrowser->AddToViewport(100000);
 #endif
@@ -465,6 +517,7 @@ void UXsollaStoreSubsystem::PurchaseItemBySku(const FString& AuthToken, const FS
 	const FOnPurchaseUpdate& SuccessCallback, const FOnError& ErrorCallback, const FOnStoreBrowserClosed& BrowserClosedCallback)
 {
 	CachedPaymentTokenRequestPayload = PurchaseParams;
+	CachedPurchaseSku = ItemSKU;
 	PaymentSuccessCallback = SuccessCallback;
 	PaymentErrorCallback = ErrorCallback;
 	PaymentBrowserClosedCallback = BrowserClosedCallback;
@@ -478,6 +531,7 @@ void UXsollaStoreSubsystem::PurchaseCart(const FString& AuthToken, const FString
 	const FOnPurchaseUpdate& SuccessCallback, const FOnError& ErrorCallback, const FOnStoreBrowserClosed& BrowserClosedCallback)
 {
 	CachedPaymentTokenRequestPayload = PurchaseParams;
+	CachedPurchaseSku.Empty();
 	PaymentSuccessCallback = SuccessCallback;
 	PaymentErrorCallback = ErrorCallback;
 	PaymentBrowserClosedCallback = BrowserClosedCallback;
@@ -490,6 +544,7 @@ void UXsollaStoreSubsystem::PurchaseCart(const FString& AuthToken, const FString
 void UXsollaStoreSubsystem::PurchaseFreeCart(const FString& AuthToken, const FString& CartId,
 	const FOnPurchaseUpdate& SuccessCallback, const FOnError& ErrorCallback)
 {
+	CachedPurchaseSku.Empty();
 	PaymentSuccessCallback = SuccessCallback;
 	PaymentErrorCallback = ErrorCallback;
 
@@ -503,7 +558,8 @@ void UXsollaStoreSubsystem::CheckOrder(const FString& AuthToken, const int32 Ord
 {
 	CachedAuthToken = AuthToken;
 
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/order/{OrderId}"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/order/{OrderId}"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("OrderId"), OrderId)
 							.Build();
@@ -511,34 +567,54 @@ void UXsollaStoreSubsystem::CheckOrder(const FString& AuthToken, const int32 Ord
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, AuthToken);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this,
 		&UXsollaStoreSubsystem::CheckOrder_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	// Order status is polled, so a response reused from the coalescing window would be outdated
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest, false);
 }
 
 void UXsollaStoreSubsystem::CheckPendingOrder(const FString& AccessToken, const int32 OrderId,
 	const FOnStoreSuccessPayment& SuccessCallback, const FOnError& ErrorCallback, bool bIsUserInvolvedToPayment)
 {
-	auto OrderCheckObject = NewObject<UXsollaOrderCheckObject>(this);
-
 	FOnOrderCheckSuccess OrderCheckSuccessCallback;
-	OrderCheckSuccessCallback.BindLambda([&, OrderCheckObject, SuccessCallback](int32 OrderId)
+	OrderCheckSuccessCallback.BindLambda([SuccessCallback](int32 CompletedOrderId)
 	{
-		UE_LOG(LogXsollaStore, Log, TEXT("Successful purchase! OrderId = %d"), OrderId);
-		OrderCheckObject->Destroy();
-		CachedOrderCheckObjects.Remove(OrderCheckObject);
 		SuccessCallback.ExecuteIfBound();
 	});
 
-	FOnOrderCheckError OrderCheckErrorCallback;
-	OrderCheckErrorCallback.BindLambda([&, OrderCheckObject, ErrorCallback](int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage)
+	TrackOrder(AccessToken, OrderId, bIsUserInvolvedToPayment, OrderCheckSuccessCallback, ErrorCallback);
+}
+
+void UXsollaStoreSubsystem::CheckOrders(const FString& AuthToken, const TArray<int32>& OrderIds,
+	const FOnCheckOrders& SuccessCallback, const int32 MaxRequestsInFlight)
+{
+	TSharedRef<FXsollaCheckOrdersRequest> Request = MakeShared<FXsollaCheckOrdersRequest>();
+	Request->AuthToken = AuthToken;
+	Request->MaxOrdersInFlight = FMath::Max(MaxRequestsInFlight, 1);
+	Request->SuccessCallback = SuccessCallback;
+
+	// The same order is checked once
+	for (const int32 OrderId : OrderIds)
 	{
-		UE_LOG(LogXsollaStore, Error, TEXT("Order checking failed - Status code: %d, Error code: %d, Error message: %s"), StatusCode, ErrorCode, *ErrorMessage);
-		OrderCheckObject->Destroy();
-		CachedOrderCheckObjects.Remove(OrderCheckObject);
-		ErrorCallback.ExecuteIfBound(StatusCode, ErrorCode, ErrorMessage);
-	});
+		Request->OrderIds.AddUnique(OrderId);
+	}
 
-	CachedOrderCheckObjects.Add(OrderCheckObject);
-	OrderCheckObject->Init(AccessToken, OrderId, bIsUserInvolvedToPayment, OrderCheckSuccessCallback, OrderCheckErrorCallback);
+	UE_LOG(LogXsollaStore, Log, TEXT("%s: Checking %d orders"), *VA_FUNC_LINE, Request->OrderIds.Num());
+	CheckNextOrders(Request);
+}
+
+TArray<int32> UXsollaStoreSubsystem::GetPendingOrderIds() const
+{
+	TArray<int32> OrderIds;
+	for (const FXsollaPurchaseJournalRecord& Purchase : UXsollaStoreSave::LoadPendingPurchases())
+	{
+		OrderIds.Add(Purchase.OrderId);
+	}
+
+	return OrderIds;
+}
+
+void UXsollaStoreSubsystem::PreconnectOrderTracking(const FString& AuthToken)
+{
+	GetGameInstance()->GetSubsystem<UCentrifugoServiceSubsystem>()->Preconnect(AuthToken);
 }
 
 void UXsollaStoreSubsystem::CreateOrderWithSpecifiedFreeItem(const FString& AuthToken, const FString& ItemSKU,
@@ -548,7 +624,8 @@ void UXsollaStoreSubsystem::CreateOrderWithSpecifiedFreeItem(const FString& Auth
 	TSharedPtr<FJsonObject> RequestDataJson = MakeShareable(new FJsonObject);
 	RequestDataJson->SetNumberField(TEXT("quantity"), Quantity);
 
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/free/item/{ItemSKU}"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/free/item/{ItemSKU}"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("ItemSKU"), ItemSKU)
 							.Build();
@@ -559,7 +636,7 @@ void UXsollaStoreSubsystem::CreateOrderWithSpecifiedFreeItem(const FString& Auth
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, Token, SerializeJson(RequestDataJson));
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::CreateOrderWithSpecifiedFreeItem_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -568,11 +645,13 @@ void UXsollaStoreSubsystem::CreateOrderWithSpecifiedFreeItem(const FString& Auth
 void UXsollaStoreSubsystem::CreateOrderWithFreeCart(const FString& AuthToken, const FString& CartId,
 	const FOnPurchaseUpdate& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Endpoint = CartId.IsEmpty()
-								 ? TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/free/cart")
-								 : TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/free/cart/{CartID}");
+	static const XsollaUtilsUrlTemplate CurrentCartUrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/free/cart"));
+	static const XsollaUtilsUrlTemplate CartUrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/free/cart/{CartID}"));
+	const XsollaUtilsUrlTemplate& UrlTemplate = CartId.IsEmpty()
+								 ? CurrentCartUrlTemplate
+								 : CartUrlTemplate;
 
-	const FString Url = XsollaUtilsUrlBuilder(Endpoint)
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("CartID"), CartId)
 							.Build();
@@ -583,7 +662,7 @@ void UXsollaStoreSubsystem::CreateOrderWithFreeCart(const FString& AuthToken, co
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, Token);
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::CreateOrderWithFreeCart_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -618,11 +697,13 @@ void UXsollaStoreSubsystem::ClearCart(const FString& AuthToken, const FString& C
 {
 	CachedAuthToken = AuthToken;
 
-	const FString Endpoint = CartId.IsEmpty()
-								 ? TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/clear")
-								 : TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/{CartID}/clear");
+	static const XsollaUtilsUrlTemplate CurrentCartUrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/clear"));
+	static const XsollaUtilsUrlTemplate CartUrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/{CartID}/clear"));
+	const XsollaUtilsUrlTemplate& UrlTemplate = CartId.IsEmpty()
+								 ? CurrentCartUrlTemplate
+								 : CartUrlTemplate;
 
-	const FString Url = XsollaUtilsUrlBuilder(Endpoint)
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("CartID"), CartId)
 							.Build();
@@ -633,7 +714,7 @@ void UXsollaStoreSubsystem::ClearCart(const FString& AuthToken, const FString& C
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_PUT, Token);
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::ClearCart_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -642,11 +723,13 @@ void UXsollaStoreSubsystem::ClearCart(const FString& AuthToken, const FString& C
 void UXsollaStoreSubsystem::GetCart(const FString& AuthToken, const FString& CartId, const FString& Currency, const FString& Locale,
 	const FOnCartUpdate& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Endpoint = CartId.IsEmpty()
-								 ? TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart")
-								 : TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/{CartID}");
+	static const XsollaUtilsUrlTemplate CurrentCartUrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart"));
+	static const XsollaUtilsUrlTemplate CartUrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/{CartID}"));
+	const XsollaUtilsUrlTemplate& UrlTemplate = CartId.IsEmpty()
+								 ? CurrentCartUrlTemplate
+								 : CartUrlTemplate;
 
-	const FString Url = XsollaUtilsUrlBuilder(Endpoint)
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("CartID"), CartId)
 							.AddStringQueryParam(TEXT("currency"), Currency)
@@ -660,7 +743,7 @@ void UXsollaStoreSubsystem::GetCart(const FString& AuthToken, const FString& Car
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::GetCart_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -675,11 +758,13 @@ void UXsollaStoreSubsystem::UpdateItemInCart(const FString& AuthToken, const FSt
 	TSharedPtr<FJsonObject> RequestDataJson = MakeShareable(new FJsonObject);
 	RequestDataJson->SetNumberField(TEXT("quantity"), Quantity);
 
-	const FString Endpoint = CartId.IsEmpty()
-								 ? TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/item/{ItemSKU}")
-								 : TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/{CartID}/item/{ItemSKU}");
+	static const XsollaUtilsUrlTemplate CurrentCartUrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/item/{ItemSKU}"));
+	static const XsollaUtilsUrlTemplate CartUrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/{CartID}/item/{ItemSKU}"));
+	const XsollaUtilsUrlTemplate& UrlTemplate = CartId.IsEmpty()
+								 ? CurrentCartUrlTemplate
+								 : CartUrlTemplate;
 
-	const FString Url = XsollaUtilsUrlBuilder(Endpoint)
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("CartID"), CartId)
 							.SetPathParam(TEXT("ItemSKU"), ItemSKU)
@@ -691,7 +776,7 @@ void UXsollaStoreSubsystem::UpdateItemInCart(const FString& AuthToken, const FSt
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_PUT, Token, SerializeJson(RequestDataJson));
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::UpdateItemInCart_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -702,11 +787,13 @@ void UXsollaStoreSubsystem::RemoveFromCart(const FString& AuthToken, const FStri
 {
 	CachedAuthToken = AuthToken;
 
-	const FString Endpoint = CartId.IsEmpty()
-								 ? TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/item/{ItemSKU}")
-								 : TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/{CartID}/item/{ItemSKU}");
+	static const XsollaUtilsUrlTemplate CurrentCartUrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/item/{ItemSKU}"));
+	static const XsollaUtilsUrlTemplate CartUrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/{CartID}/item/{ItemSKU}"));
+	const XsollaUtilsUrlTemplate& UrlTemplate = CartId.IsEmpty()
+								 ? CurrentCartUrlTemplate
+								 : CartUrlTemplate;
 
-	const FString Url = XsollaUtilsUrlBuilder(Endpoint)
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("CartID"), CartId)
 							.SetPathParam(TEXT("ItemSKU"), ItemSKU)
@@ -718,7 +805,7 @@ void UXsollaStoreSubsystem::RemoveFromCart(const FString& AuthToken, const FStri
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_DELETE, Token);
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::RemoveFromCart_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -727,11 +814,13 @@ void UXsollaStoreSubsystem::RemoveFromCart(const FString& AuthToken, const FStri
 void UXsollaStoreSubsystem::FillCartById(const FString& AuthToken, const FString& CartId, const TArray<FStoreCartItem>& Items,
 	const FOnCartUpdate& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Endpoint = CartId.IsEmpty()
-								 ? TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/fill")
-								 : TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/{CartID}/fill");
+	static const XsollaUtilsUrlTemplate CurrentCartUrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/fill"));
+	static const XsollaUtilsUrlTemplate CartUrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/cart/{CartID}/fill"));
+	const XsollaUtilsUrlTemplate& UrlTemplate = CartId.IsEmpty()
+								 ? CurrentCartUrlTemplate
+								 : CartUrlTemplate;
 
-	const FString Url = XsollaUtilsUrlBuilder(Endpoint)
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("CartID"), CartId)
 							.Build();
@@ -755,7 +844,7 @@ void UXsollaStoreSubsystem::FillCartById(const FString& AuthToken, const FString
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_PUT, Token, SerializeJson(JsonObject));
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::FillCartById_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -764,7 +853,8 @@ void UXsollaStoreSubsystem::FillCartById(const FString& AuthToken, const FString
 void UXsollaStoreSubsystem::GetSpecifiedBundle(const FString& Sku,
 	const FOnGetSpecifiedBundleUpdate& SuccessCallback, const FOnError& ErrorCallback, const FString& AuthToken)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/bundle/sku/{Sku}"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/bundle/sku/{Sku}"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("Sku"), Sku)
 							.Build();
@@ -775,7 +865,7 @@ void UXsollaStoreSubsystem::GetSpecifiedBundle(const FString& Sku,
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::GetSpecifiedBundle_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -784,22 +874,16 @@ void UXsollaStoreSubsystem::GetSpecifiedBundle(const FString& Sku,
 void UXsollaStoreSubsystem::GetPaginatedBundles(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnGetListOfBundlesUpdate& SuccessCallback, const FOnError& ErrorCallback, const int Limit, const int Offset, const FString& AuthToken)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/bundle"))
-							.SetPathParam(TEXT("ProjectID"), ProjectID)
-							.AddStringQueryParam(TEXT("locale"), Locale)
-							.AddStringQueryParam(TEXT("country"), Country)
-							.AddArrayQueryParam(TEXT("additional_fields[]"), AdditionalFields)
-							.AddNumberQueryParam(TEXT("limit"), Limit)
-							.AddNumberQueryParam(TEXT("offset"), Offset)
-							.Build();
+	const FString Url = GetBundlesUrl(Locale, Country, AdditionalFields, Limit, Offset);
 
 	FOnTokenUpdate SuccessTokenUpdate;
 	SuccessTokenUpdate.BindLambda([&, Url, SuccessCallback, ErrorCallback, SuccessTokenUpdate](const FString& Token, bool bRepeatOnError)
 	{
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
+		XsollaUtilsHttpRequestHelper::EnableResponseCache(HttpRequest);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::GetListOfBundles_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -808,17 +892,24 @@ void UXsollaStoreSubsystem::GetPaginatedBundles(const FString& Locale, const FSt
 void UXsollaStoreSubsystem::GetBundles(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnGetListOfBundlesUpdate& SuccessCallback, const FOnError& ErrorCallback, const FString& AuthToken)
 {
-	GetAllBundlesParams = FGetAllBundlesParams(Locale, Country, AdditionalFields, SuccessCallback, ErrorCallback, AuthToken);
-	GetAllBundlesParams.CurrentSuccessCallback.BindDynamic(this, &UXsollaStoreSubsystem::GetBundlesCallback);
-	GetAllBundlesParams.CurrentErrorCallback.BindDynamic(this, &UXsollaStoreSubsystem::GetBundlesError);
-	CallGetBundles();
+	StartPaginatedRequest<FGetAllBundlesParams, FStoreListOfBundles>(GetAllBundlesRequests,
+		FGetAllBundlesParams(Locale, Country, AdditionalFields, SuccessCallback, ErrorCallback, AuthToken),
+		[this](const FGetAllBundlesParams& Params, int32 PageOffset)
+		{
+			return GetBundlesUrl(Params.Locale, Params.Country, Params.AdditionalFields, Params.Limit, PageOffset);
+		},
+		[this](const FString& QueryKey, const FGetAllBundlesParams& Params)
+		{
+			UpdateCatalog(QueryKey, Params.ResultData);
+		});
 }
 
 void UXsollaStoreSubsystem::GetVirtualCurrency(const FString& CurrencySKU,
 	const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnCurrencyUpdate& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/virtual_currency/sku/{CurrencySKU}"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/virtual_currency/sku/{CurrencySKU}"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("CurrencySKU"), CurrencySKU)
 							.AddStringQueryParam(TEXT("locale"), Locale)
@@ -829,14 +920,15 @@ void UXsollaStoreSubsystem::GetVirtualCurrency(const FString& CurrencySKU,
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this,
 		&UXsollaStoreSubsystem::GetVirtualCurrency_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaStoreSubsystem::GetVirtualCurrencyPackage(const FString& PackageSKU,
 	const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnCurrencyPackageUpdate& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/virtual_currency/package/sku/{PackageSKU}"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/virtual_currency/package/sku/{PackageSKU}"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("PackageSKU"), PackageSKU)
 							.AddStringQueryParam(TEXT("locale"), Locale)
@@ -847,7 +939,7 @@ void UXsollaStoreSubsystem::GetVirtualCurrencyPackage(const FString& PackageSKU,
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this,
 		&UXsollaStoreSubsystem::GetVirtualCurrencyPackage_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaStoreSubsystem::BuyItemWithVirtualCurrency(const FString& AuthToken,
@@ -858,7 +950,8 @@ void UXsollaStoreSubsystem::BuyItemWithVirtualCurrency(const FString& AuthToken,
 
 	const FString PlatformName = Platform == EXsollaPublishingPlatform::undefined ? TEXT("") : UXsollaUtilsLibrary::EnumToString<EXsollaPublishingPlatform>(Platform);
 
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/payment/item/{ItemSKU}/virtual/{CurrencySKU}"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/payment/item/{ItemSKU}/virtual/{CurrencySKU}"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("ItemSKU"), ItemSKU)
 							.SetPathParam(TEXT("CurrencySKU"), CurrencySKU)
@@ -871,7 +964,7 @@ void UXsollaStoreSubsystem::BuyItemWithVirtualCurrency(const FString& AuthToken,
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::BuyItemWithVirtualCurrency_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -880,7 +973,8 @@ void UXsollaStoreSubsystem::BuyItemWithVirtualCurrency(const FString& AuthToken,
 void UXsollaStoreSubsystem::GetPromocodeRewards(const FString& AuthToken, const FString& PromocodeCode,
 	const FOnGetPromocodeRewardsUpdate& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/promocode/code/{PromocodeCode}/rewards"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/promocode/code/{PromocodeCode}/rewards"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("PromocodeCode"), PromocodeCode)
 							.Build();
@@ -891,7 +985,7 @@ void UXsollaStoreSubsystem::GetPromocodeRewards(const FString& AuthToken, const
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::GetPromocodeRewards_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -900,7 +994,8 @@ void UXsollaStoreSubsystem::GetPromocodeRewards(const FString& AuthToken, const
 void UXsollaStoreSubsystem::RedeemPromocode(const FString& AuthToken, const FString& PromocodeCode, const FString& CartId,
 	const FOnPromocodeUpdate& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/promocode/redeem"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/promocode/redeem"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.Build();
 
@@ -918,7 +1013,7 @@ void UXsollaStoreSubsystem::RedeemPromocode(const FString& AuthToken, const FStr
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, Token, SerializeJson(RequestDataJson));
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::RedeemPromocode_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -927,7 +1022,8 @@ void UXsollaStoreSubsystem::RedeemPromocode(const FString& AuthToken, const FStr
 void UXsollaStoreSubsystem::RemovePromocodeFromCart(const FString& AuthToken, const FString& CartId,
 	const FOnPromocodeUpdate& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/promocode/remove"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/promocode/remove"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.Build();
 
@@ -944,7 +1040,7 @@ void UXsollaStoreSubsystem::RemovePromocodeFromCart(const FString& AuthToken, co
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_PUT, Token, SerializeJson(RequestDataJson));
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::RemovePromocodeFromCart_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -953,7 +1049,8 @@ void UXsollaStoreSubsystem::RemovePromocodeFromCart(const FString& AuthToken, co
 void UXsollaStoreSubsystem::GetGamesList(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnStoreGamesUpdate& SuccessCallback, const FOnError& ErrorCallback, const int Limit, const int Offset)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/game"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/game"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.AddStringQueryParam(TEXT("locale"), Locale)
 							.AddStringQueryParam(TEXT("country"), Country)
@@ -965,13 +1062,14 @@ void UXsollaStoreSubsystem::GetGamesList(const FString& Locale, const FString& C
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this,
 		&UXsollaStoreSubsystem::GetGamesList_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaStoreSubsystem::GetGamesListBySpecifiedGroup(const FString& ExternalId, const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnGetGamesListBySpecifiedGroup& SuccessCallback, const FOnError& ErrorCallback, const int Limit, const int Offset)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/game/group/{ExternalId}"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/game/group/{ExternalId}"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("ExternalId"), ExternalId.IsEmpty() ? TEXT("all") : ExternalId)
 							.AddStringQueryParam(TEXT("locale"), Locale)
@@ -984,13 +1082,14 @@ void UXsollaStoreSubsystem::GetGamesListBySpecifiedGroup(const FString& External
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this,
 		&UXsollaStoreSubsystem::GetGamesListBySpecifiedGroup_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaStoreSubsystem::GetGameItem(const FString& GameSKU, const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnGameUpdate& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/game/sku/{GameSKU}"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/game/sku/{GameSKU}"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("GameSKU"), GameSKU)
 							.AddStringQueryParam(TEXT("locale"), Locale)
@@ -1001,13 +1100,14 @@ void UXsollaStoreSubsystem::GetGameItem(const FString& GameSKU, const FString& L
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this,
 		&UXsollaStoreSubsystem::GetGameItem_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaStoreSubsystem::GetGameKeyItem(const FString& ItemSKU, const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnGameKeyUpdate& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/game/key/sku/{ItemSKU}"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/game/key/sku/{ItemSKU}"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("ItemSKU"), ItemSKU)
 							.AddStringQueryParam(TEXT("locale"), Locale)
@@ -1018,13 +1118,14 @@ void UXsollaStoreSubsystem::GetGameKeyItem(const FString& ItemSKU, const FString
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this,
 		&UXsollaStoreSubsystem::GetGameKeyItem_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaStoreSubsystem::GetGameKeysListBySpecifiedGroup(const FString& ExternalId, const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
 	const FOnGetGameKeysListBySpecifiedGroup& SuccessCallback, const FOnError& ErrorCallback, const int Limit, const int Offset)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/game/key/group/{ExternalId}"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/game/key/group/{ExternalId}"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.SetPathParam(TEXT("ExternalId"), ExternalId.IsEmpty() ? TEXT("all") : ExternalId)
 							.AddStringQueryParam(TEXT("locale"), Locale)
@@ -1037,25 +1138,27 @@ void UXsollaStoreSubsystem::GetGameKeysListBySpecifiedGroup(const FString& Exter
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this,
 		&UXsollaStoreSubsystem::GetGameKeysListBySpecifiedGroup_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaStoreSubsystem::GetDRMList(const FOnDRMListUpdate& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/game/drm"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/game/drm"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.Build();
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this,
 		&UXsollaStoreSubsystem::GetDRMList_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaStoreSubsystem::GetOwnedGames(const FString& AuthToken, const TArray<FString>& AdditionalFields,
 	const FOnOwnedGamesListUpdate& SuccessCallback, const FOnError& ErrorCallback, const int Limit, const int Offset, const bool bIsSandbox)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/entitlement"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/entitlement"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.AddArrayQueryParam(TEXT("additional_fields[]"), AdditionalFields)
 							.AddNumberQueryParam(TEXT("limit"), Limit)
@@ -1069,7 +1172,7 @@ void UXsollaStoreSubsystem::GetOwnedGames(const FString& AuthToken, const TArray
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::GetOwnedGames_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1078,7 +1181,8 @@ void UXsollaStoreSubsystem::GetOwnedGames(const FString& AuthToken, const TArray
 void UXsollaStoreSubsystem::RedeemGameCodeByClient(const FString& AuthToken, const FString& Code,
 	const FOnRedeemGameCodeSuccess& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/entitlement/redeem"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/entitlement/redeem"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 							.SetPathParam(TEXT("ProjectID"), ProjectID)
 							.Build();
 
@@ -1093,7 +1197,7 @@ void UXsollaStoreSubsystem::RedeemGameCodeByClient(const FString& AuthToken, con
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, Token, SerializeJson(RequestDataJson));
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::RedeemGameCodeByClient_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1102,7 +1206,8 @@ void UXsollaStoreSubsystem::RedeemGameCodeByClient(const FString& AuthToken, con
 void UXsollaStoreSubsystem::GetSubscriptionPublicPlans(const TArray<int> PlanId, const TArray<FString>& PlanExternalId, const FString& Country, const FString& Locale,
 		const FOnSubscriptionPublicPlansListUpdate& SuccessCallback, const FOnError& ErrorCallback,	const int Limit, const int Offset)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://subscriptions.xsolla.com/api/public/v1/projects/{ProjectID}/user_plans"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://subscriptions.xsolla.com/api/public/v1/projects/{ProjectID}/user_plans"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 								.SetPathParam(TEXT("ProjectID"), ProjectID)
 								.AddArrayQueryParam(TEXT("plan_id[]"), PlanId)
 								.AddArrayQueryParam(TEXT("plan_external_id[]"), PlanExternalId)
@@ -1114,13 +1219,14 @@ void UXsollaStoreSubsystem::GetSubscriptionPublicPlans(const TArray<int> PlanId,
 
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET);
 	HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::GetSubscriptionPublicPlans_HttpRequestComplete, SuccessCallback, ErrorCallback);
-	HttpRequest->ProcessRequest();
+	XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 }
 
 void UXsollaStoreSubsystem::GetSubscriptionPlans(const FString& AuthToken, const TArray<int> PlanId, const TArray<FString>& PlanExternalId, const FString& Country, const FString& Locale,
 	const FOnSubscriptionPlansListUpdate& SuccessCallback, const FOnError& ErrorCallback, const int Limit, const int Offset)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://subscriptions.xsolla.com/api/user/v1/projects/{ProjectID}/plans"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://subscriptions.xsolla.com/api/user/v1/projects/{ProjectID}/plans"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 								.SetPathParam(TEXT("ProjectID"), ProjectID)
 								.AddArrayQueryParam(TEXT("plan_id[]"), PlanId)
 								.AddArrayQueryParam(TEXT("plan_external_id[]"), PlanExternalId)
@@ -1136,7 +1242,7 @@ void UXsollaStoreSubsystem::GetSubscriptionPlans(const FString& AuthToken, const
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::GetSubscriptionPlans_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1145,7 +1251,8 @@ void UXsollaStoreSubsystem::GetSubscriptionPlans(const FString& AuthToken, const
 void UXsollaStoreSubsystem::GetSubscriptions(const FString& AuthToken, const FString& Locale,
 	const FOnSubscriptionsListUpdate& SuccessCallback, const FOnError& ErrorCallback, const int Limit, const int Offset)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://subscriptions.xsolla.com/api/user/v1/projects/{ProjectID}/subscriptions"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://subscriptions.xsolla.com/api/user/v1/projects/{ProjectID}/subscriptions"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 								.SetPathParam(TEXT("ProjectID"), ProjectID)
 								.AddStringQueryParam(TEXT("locale"), Locale)
 								.AddNumberQueryParam(TEXT("limit"), Limit)
@@ -1158,7 +1265,7 @@ void UXsollaStoreSubsystem::GetSubscriptions(const FString& AuthToken, const FSt
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::GetSubscriptions_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1167,7 +1274,8 @@ void UXsollaStoreSubsystem::GetSubscriptions(const FString& AuthToken, const FSt
 void UXsollaStoreSubsystem::GetSubscriptionDetails(const FString& AuthToken, const int32 SubscriptionId, const FString& Locale,
 	const FOnGetSubscriptionDetailsSuccess& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://subscriptions.xsolla.com/api/user/v1/projects/{ProjectID}/subscriptions/{SubscriptionId}"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://subscriptions.xsolla.com/api/user/v1/projects/{ProjectID}/subscriptions/{SubscriptionId}"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 								.SetPathParam(TEXT("ProjectID"), ProjectID)
 								.SetPathParam(TEXT("SubscriptionId"), SubscriptionId)
 								.AddStringQueryParam(TEXT("locale"), Locale)
@@ -1179,7 +1287,7 @@ void UXsollaStoreSubsystem::GetSubscriptionDetails(const FString& AuthToken, con
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::GetSubscriptionDetails_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1188,7 +1296,8 @@ void UXsollaStoreSubsystem::GetSubscriptionDetails(const FString& AuthToken, con
 void UXsollaStoreSubsystem::GetSubscriptionPurchaseUrl(const FString& AuthToken, const FString& PlanExternalId, const FString& Country,
 	const FOnGetSubscriptionPayStationLinkSuccess& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://subscriptions.xsolla.com/api/user/v1/projects/{ProjectID}/subscriptions/buy"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://subscriptions.xsolla.com/api/user/v1/projects/{ProjectID}/subscriptions/buy"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 								.SetPathParam(TEXT("ProjectID"), ProjectID)
 								.AddStringQueryParam(TEXT("country"), Country)
 								.Build();
@@ -1208,7 +1317,7 @@ void UXsollaStoreSubsystem::GetSubscriptionPurchaseUrl(const FString& AuthToken,
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, Token, SerializeJson(RequestDataJson));
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::GetSubscriptionPaystationLink_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1217,7 +1326,8 @@ void UXsollaStoreSubsystem::GetSubscriptionPurchaseUrl(const FString& AuthToken,
 void UXsollaStoreSubsystem::GetSubscriptionManagementUrl(const FString& AuthToken, const FString& Country,
 	const FOnGetSubscriptionPayStationLinkSuccess& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://subscriptions.xsolla.com/api/user/v1/projects/{ProjectID}/subscriptions/manage"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://subscriptions.xsolla.com/api/user/v1/projects/{ProjectID}/subscriptions/manage"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 								.SetPathParam(TEXT("ProjectID"), ProjectID)
 								.AddStringQueryParam(TEXT("country"), Country)
 								.Build();
@@ -1235,7 +1345,7 @@ void UXsollaStoreSubsystem::GetSubscriptionManagementUrl(const FString& AuthToke
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, Token, SerializeJson(RequestDataJson));
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::GetSubscriptionPaystationLink_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1244,7 +1354,8 @@ void UXsollaStoreSubsystem::GetSubscriptionManagementUrl(const FString& AuthToke
 void UXsollaStoreSubsystem::GetSubscriptionRenewalUrl(const FString& AuthToken, const int32 SubscriptionId,
 	const FOnGetSubscriptionPayStationLinkSuccess& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://subscriptions.xsolla.com/api/user/v1/projects/{ProjectID}/subscriptions/{SubscriptionId}/renew"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://subscriptions.xsolla.com/api/user/v1/projects/{ProjectID}/subscriptions/{SubscriptionId}/renew"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 								.SetPathParam(TEXT("ProjectID"), ProjectID)
 								.SetPathParam(TEXT("SubscriptionId"), SubscriptionId)
 								.Build();
@@ -1262,7 +1373,7 @@ void UXsollaStoreSubsystem::GetSubscriptionRenewalUrl(const FString& AuthToken,
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_POST, Token, SerializeJson(RequestDataJson));
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::GetSubscriptionPaystationLink_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1271,7 +1382,8 @@ void UXsollaStoreSubsystem::GetSubscriptionRenewalUrl(const FString& AuthToken,
 void UXsollaStoreSubsystem::CancelSubscription(const FString& AuthToken, const int32 SubscriptionId,
 	const FOnCancelSubscriptionSuccess& SuccessCallback, const FOnError& ErrorCallback)
 {
-	const FString Url = XsollaUtilsUrlBuilder(TEXT("https://subscriptions.xsolla.com/api/user/v1/projects/{ProjectID}/subscriptions/{SubscriptionId}/cancel"))
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://subscriptions.xsolla.com/api/user/v1/projects/{ProjectID}/subscriptions/{SubscriptionId}/cancel"));
+	const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
 								.SetPathParam(TEXT("ProjectID"), ProjectID)
 								.SetPathParam(TEXT("SubscriptionId"), SubscriptionId)
 								.Build();
@@ -1282,7 +1394,7 @@ void UXsollaStoreSubsystem::CancelSubscription(const FString& AuthToken, const i
 		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
 		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_PUT, Token);
 		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::CancelSubscription_HttpRequestComplete, SuccessCallback, ErrorHandlersWrapper);
-		HttpRequest->ProcessRequest();
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
 	});
 
 	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
@@ -1305,19 +1417,17 @@ void UXsollaStoreSubsystem::GetVirtualItems_HttpRequestComplete(
 	// Log HTTP response
 	XsollaUtilsLoggingHelper::LogHttpResponse(HttpRequest, HttpResponse);
 
-	XsollaHttpRequestError OutError;
-	FStoreItemsData ItemsData;
-
-	if (XsollaUtilsHttpRequestHelper::ParseResponseAsStruct(HttpRequest, HttpResponse, bSucceeded, FStoreItemsData::StaticStruct(), &ItemsData, OutError))
-	{
-		UE_LOG(LogXsollaStore, Log, TEXT("%s: GetVirtualItems request: JSON received. Items count: %d. has_more: %s"),
-			*VA_FUNC_LINE, ItemsData.Items.Num(), ItemsData.has_more ? TEXT("true") : TEXT("false"));
-		SuccessCallback.ExecuteIfBound(ItemsData);
-	}
-	else
-	{
-		LoginSubsystem->HandleRequestError(OutError, ErrorHandlersWrapper);
-	}
+	XsollaUtilsHttpRequestHelper::ParseResponseAsStructAsync<FStoreItemsData>(this, HttpRequest, HttpResponse, bSucceeded,
+		[SuccessCallback](const FStoreItemsData& ItemsData)
+		{
+			UE_LOG(LogXsollaStore, Log, TEXT("%s: GetVirtualItems request: JSON received. Items count: %d. has_more: %s"),
+				*VA_FUNC_LINE, ItemsData.Items.Num(), ItemsData.has_more ? TEXT("true") : TEXT("false"));
+			SuccessCallback.ExecuteIfBound(ItemsData);
+		},
+		[this, ErrorHandlersWrapper](const XsollaHttpRequestError& OutError)
+		{
+			LoginSubsystem->HandleRequestError(OutError, ErrorHandlersWrapper);
+		});
 }
 
 void UXsollaStoreSubsystem::GetItemGroups_HttpRequestComplete(
@@ -1349,19 +1459,17 @@ void UXsollaStoreSubsystem::GetVirtualCurrencies_HttpRequestComplete(
 	// Log HTTP response
 	XsollaUtilsLoggingHelper::LogHttpResponse(HttpRequest, HttpResponse);
 
-	XsollaHttpRequestError OutError;
-	FVirtualCurrencyData VirtualCurrencyData;
-
-	if (XsollaUtilsHttpRequestHelper::ParseResponseAsStruct(HttpRequest, HttpResponse, bSucceeded, FVirtualCurrencyData::StaticStruct(), &VirtualCurrencyData, OutError))
-	{
-		UE_LOG(LogXsollaStore, Log, TEXT("%s: GetVirtualCurrencies request: JSON received. Items count: %d. has_more: %s"),
-			*VA_FUNC_LINE, VirtualCurrencyData.Items.Num(), VirtualCurrencyData.has_more ? TEXT("true") : TEXT("false"));
-		SuccessCallback.ExecuteIfBound(VirtualCurrencyData);
-	}
-	else
-	{
-		HandleRequestError(OutError, ErrorCallback);
-	}
+	XsollaUtilsHttpRequestHelper::ParseResponseAsStructAsync<FVirtualCurrencyData>(this, HttpRequest, HttpResponse, bSucceeded,
+		[SuccessCallback](const FVirtualCurrencyData& VirtualCurrencyData)
+		{
+			UE_LOG(LogXsollaStore, Log, TEXT("%s: GetVirtualCurrencies request: JSON received. Items count: %d. has_more: %s"),
+				*VA_FUNC_LINE, VirtualCurrencyData.Items.Num(), VirtualCurrencyData.has_more ? TEXT("true") : TEXT("false"));
+			SuccessCallback.ExecuteIfBound(VirtualCurrencyData);
+		},
+		[this, ErrorCallback](const XsollaHttpRequestError& OutError)
+		{
+			HandleRequestError(OutError, ErrorCallback);
+		});
 }
 
 void UXsollaStoreSubsystem::GetVirtualCurrencyPackages_HttpRequestComplete(
@@ -1371,19 +1479,17 @@ void UXsollaStoreSubsystem::GetVirtualCurrencyPackages_HttpRequestComplete(
 	// Log HTTP response
 	XsollaUtilsLoggingHelper::LogHttpResponse(HttpRequest, HttpResponse);
 
-	XsollaHttpRequestError OutError;
-	FVirtualCurrencyPackagesData VirtualCurrencyPackages;
-
-	if (XsollaUtilsHttpRequestHelper::ParseResponseAsStruct(HttpRequest, HttpResponse, bSucceeded, FVirtualCurrencyPackagesData::StaticStruct(), &VirtualCurrencyPackages, OutError))
-	{
-		UE_LOG(LogXsollaStore, Log, TEXT("%s: GetVirtualCurrencyPackages request: JSON received. Items count: %d. has_more: %s"),
-			*VA_FUNC_LINE, VirtualCurrencyPackages.Items.Num(), VirtualCurrencyPackages.has_more ? TEXT("true") : TEXT("false"));
-		SuccessCallback.ExecuteIfBound(VirtualCurrencyPackages);
-	}
-	else
-	{
-		LoginSubsystem->HandleRequestError(OutError, ErrorHandlersWrapper);
-	}
+	XsollaUtilsHttpRequestHelper::ParseResponseAsStructAsync<FVirtualCurrencyPackagesData>(this, HttpRequest, HttpResponse, bSucceeded,
+		[SuccessCallback](const FVirtualCurrencyPackagesData& VirtualCurrencyPackages)
+		{
+			UE_LOG(LogXsollaStore, Log, TEXT("%s: GetVirtualCurrencyPackages request: JSON received. Items count: %d. has_more: %s"),
+				*VA_FUNC_LINE, VirtualCurrencyPackages.Items.Num(), VirtualCurrencyPackages.has_more ? TEXT("true") : TEXT("false"));
+			SuccessCallback.ExecuteIfBound(VirtualCurrencyPackages);
+		},
+		[this, ErrorHandlersWrapper](const XsollaHttpRequestError& OutError)
+		{
+			LoginSubsystem->HandleRequestError(OutError, ErrorHandlersWrapper);
+		});
 }
 
 void UXsollaStoreSubsystem::GetItemsListBySpecifiedGroup_HttpRequestComplete(
@@ -1393,19 +1499,17 @@ void UXsollaStoreSubsystem::GetItemsListBySpecifiedGroup_HttpRequestComplete(
 	// Log HTTP response
 	XsollaUtilsLoggingHelper::LogHttpResponse(HttpRequest, HttpResponse);
 
-	XsollaHttpRequestError OutError;
-	FStoreItemsList ItemsList;
-
-	if (XsollaUtilsHttpRequestHelper::ParseResponseAsStruct(HttpRequest, HttpResponse, bSucceeded, FStoreItemsList::StaticStruct(), &ItemsList, OutError))
-	{
-		UE_LOG(LogXsollaStore, Log, TEXT("%s: GetItemsListBySpecifiedGroup request: JSON received. Items count: %d. has_more: %s"),
-			*VA_FUNC_LINE, ItemsList.Items.Num(), ItemsList.has_more ? TEXT("true") : TEXT("false"));
-		SuccessCallback.ExecuteIfBound(ItemsList);
-	}
-	else
-	{
-		LoginSubsystem->HandleRequestError(OutError, ErrorHandlersWrapper);
-	}
+	XsollaUtilsHttpRequestHelper::ParseResponseAsStructAsync<FStoreItemsList>(this, HttpRequest, HttpResponse, bSucceeded,
+		[SuccessCallback](const FStoreItemsList& ItemsList)
+		{
+			UE_LOG(LogXsollaStore, Log, TEXT("%s: GetItemsListBySpecifiedGroup request: JSON received. Items count: %d. has_more: %s"),
+				*VA_FUNC_LINE, ItemsList.Items.Num(), ItemsList.has_more ? TEXT("true") : TEXT("false"));
+			SuccessCallback.ExecuteIfBound(ItemsList);
+		},
+		[this, ErrorHandlersWrapper](const XsollaHttpRequestError& OutError)
+		{
+			LoginSubsystem->HandleRequestError(OutError, ErrorHandlersWrapper);
+		});
 }
 
 void UXsollaStoreSubsystem::GetAllItemsList_HttpRequestComplete(
@@ -1415,19 +1519,17 @@ void UXsollaStoreSubsystem::GetAllItemsList_HttpRequestComplete(
 	// Log HTTP response
 	XsollaUtilsLoggingHelper::LogHttpResponse(HttpRequest, HttpResponse);
 
-	XsollaHttpRequestError OutError;
-	FStoreItemsList Items;
-
-	if (XsollaUtilsHttpRequestHelper::ParseResponseAsStruct(HttpRequest, HttpResponse, bSucceeded, FStoreItemsList::StaticStruct(), &Items, OutError))
-	{
-		UE_LOG(LogXsollaStore, Log, TEXT("%s: GetAllItemsList request: JSON received. Items count: %d"),
-			*VA_FUNC_LINE, Items.Items.Num());
-		SuccessCallback.ExecuteIfBound(Items);
-	}
-	else
-	{
-		LoginSubsystem->HandleRequestError(OutError, ErrorHandlersWrapper);
-	}
+	XsollaUtilsHttpRequestHelper::ParseResponseAsStructAsync<FStoreItemsList>(this, HttpRequest, HttpResponse, bSucceeded,
+		[SuccessCallback](const FStoreItemsList& Items)
+		{
+			UE_LOG(LogXsollaStore, Log, TEXT("%s: GetAllItemsList request: JSON received. Items count: %d"),
+				*VA_FUNC_LINE, Items.Items.Num());
+			SuccessCallback.ExecuteIfBound(Items);
+		},
+		[this, ErrorHandlersWrapper](const XsollaHttpRequestError& OutError)
+		{
+			LoginSubsystem->HandleRequestError(OutError, ErrorHandlersWrapper);
+		});
 }
 
 void UXsollaStoreSubsystem::FetchPaymentToken_HttpRequestComplete(
@@ -1466,33 +1568,10 @@ void UXsollaStoreSubsystem::CheckOrder_HttpRequestComplete(
 
 	if (XsollaUtilsHttpRequestHelper::ParseResponseAsStruct(HttpRequest, HttpResponse, bSucceeded, FXsollaOrder::StaticStruct(), &Order, OutError))
 	{
-		FString OrderStatusStr = Order.status;
-
-		EXsollaOrderStatus OrderStatus = EXsollaOrderStatus::Unknown;
-
-		if (OrderStatusStr == TEXT("new"))
-		{
-			OrderStatus = EXsollaOrderStatus::New;
-		}
-		else if (OrderStatusStr == TEXT("paid"))
-		{
-			OrderStatus = EXsollaOrderStatus::Paid;
-		}
-		else if (OrderStatusStr == TEXT("done"))
-		{
-			OrderStatus = EXsollaOrderStatus::Done;
-		}
-		else if (OrderStatusStr == TEXT("canceled"))
-		{
-			OrderStatus = EXsollaOrderStatus::Canceled;
-		}
-		else
-		{
-			UE_LOG(LogXsollaStore, Warning, TEXT("%s: Unknown order status: %s [%d]"), *VA_FUNC_LINE, *OrderStatusStr, Order.order_id);
-		}
+		const EXsollaOrderStatus OrderStatus = ParseOrderStatus(Order);
 
 		UE_LOG(LogXsollaStore, Log, TEXT("%s: Order check complete - ID: %d, Status: %s"),
-			*VA_FUNC_LINE, Order.order_id, *OrderStatusStr);
+			*VA_FUNC_LINE, Order.order_id, *Order.status);
 		SuccessCallback.ExecuteIfBound(Order.order_id, OrderStatus, Order.content);
 		return;
 	}
@@ -1500,6 +1579,39 @@ void UXsollaStoreSubsystem::CheckOrder_HttpRequestComplete(
 	HandleRequestError(OutError, ErrorCallback);
 }
 
+void UXsollaStoreSubsystem::CheckOrders_HttpRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse,
+	const bool bSucceeded, TSharedRef<FXsollaCheckOrdersRequest> Request, const int32 OrderId,
+	UXsollaCheckOrderRequestObject* RequestObject, FErrorHandlersWrapper ErrorHandlersWrapper)
+{
+	// Log HTTP response
+	XsollaUtilsLoggingHelper::LogHttpResponse(HttpRequest, HttpResponse);
+
+	FXsollaOrder Order;
+	XsollaHttpRequestError OutError;
+
+	if (XsollaUtilsHttpRequestHelper::ParseResponseAsStruct(HttpRequest, HttpResponse, bSucceeded, FXsollaOrder::StaticStruct(), &Order, OutError))
+	{
+		FXsollaOrderCheckResult& Result = Request->Results.Results.Add(OrderId);
+		Result.bSucceeded = true;
+		Result.OrderStatus = ParseOrderStatus(Order);
+		Result.OrderContent = Order.content;
+
+		FinishOrderCheck(Request, RequestObject);
+		return;
+	}
+
+	// Repeated request isn't repeated again, its error is reported right away so the batch completes
+	const bool bIsTokenError = OutError.statusCode == 401 || OutError.statusCode == 403;
+	if (bIsTokenError && !ErrorHandlersWrapper.bNeedRepeatRequest)
+	{
+		FailOrderCheck(Request, OrderId, RequestObject, OutError.statusCode, OutError.errorCode,
+			OutError.errorMessage.IsEmpty() ? OutError.description : OutError.errorMessage);
+		return;
+	}
+
+	LoginSubsystem->HandleRequestError(OutError, ErrorHandlersWrapper);
+}
+
 void UXsollaStoreSubsystem::CreateOrderWithSpecifiedFreeItem_HttpRequestComplete(
 	FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse,
 	const bool bSucceeded, FOnPurchaseUpdate SuccessCallback, FErrorHandlersWrapper ErrorHandlersWrapper)
@@ -1631,19 +1743,17 @@ void UXsollaStoreSubsystem::GetListOfBundles_HttpRequestComplete(
 	// Log HTTP response
 	XsollaUtilsLoggingHelper::LogHttpResponse(HttpRequest, HttpResponse);
 
-	XsollaHttpRequestError OutError;
-	FStoreListOfBundles ListOfBundles;
-
-	if (XsollaUtilsHttpRequestHelper::ParseResponseAsStruct(HttpRequest, HttpResponse, bSucceeded, FStoreListOfBundles::StaticStruct(), &ListOfBundles, OutError))
-	{
-		UE_LOG(LogXsollaStore, Log, TEXT("%s: GetBundles request: JSON received. Items count: %d. has_more: %s"),
-			*VA_FUNC_LINE, ListOfBundles.items.Num(), ListOfBundles.has_more ? TEXT("true") : TEXT("false"));
-		SuccessCallback.ExecuteIfBound(ListOfBundles);
-	}
-	else
-	{
-		LoginSubsystem->HandleRequestError(OutError, ErrorHandlersWrapper);
-	}
+	XsollaUtilsHttpRequestHelper::ParseResponseAsStructAsync<FStoreListOfBundles>(this, HttpRequest, HttpResponse, bSucceeded,
+		[SuccessCallback](const FStoreListOfBundles& ListOfBundles)
+		{
+			UE_LOG(LogXsollaStore, Log, TEXT("%s: GetBundles request: JSON received. Items count: %d. has_more: %s"),
+				*VA_FUNC_LINE, ListOfBundles.items.Num(), ListOfBundles.has_more ? TEXT("true") : TEXT("false"));
+			SuccessCallback.ExecuteIfBound(ListOfBundles);
+		},
+		[this, ErrorHandlersWrapper](const XsollaHttpRequestError& OutError)
+		{
+			LoginSubsystem->HandleRequestError(OutError, ErrorHandlersWrapper);
+		});
 }
 
 void UXsollaStoreSubsystem::GetSpecifiedBundle_HttpRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse,
@@ -2063,6 +2173,7 @@ void UXsollaStoreSubsystem::InnerPurchase(const FString& AuthToken, const FStrin
 {
 	CachedAuthToken = AuthToken;
 	CachedPaymentTokenRequestPayload = PaymentTokenRequestPayload;
+	CachedPurchaseSku = Sku;
 
 	PaymentSuccessCallback = SuccessCallback;
 	PaymentErrorCallback = ErrorCallback;
@@ -2092,6 +2203,8 @@ void UXsollaStoreSubsystem::InnerPurchase(const FString& AuthToken, const FStrin
 void UXsollaStoreSubsystem::FetchTokenCallback(const FString& AccessToken, int32 InOrderId)
 {
 	PaymentOrderId = InOrderId;
+	JournalPurchase(InOrderId, EXsollaPurchaseJournalState::Created, AccessToken, CachedPurchaseSku);
+
 	FOnStoreSuccessPayment SuccessPaymentCallback;
 	SuccessPaymentCallback.BindDynamic(this, &UXsollaStoreSubsystem::CheckPendingOrderSuccessCallback);
 	LaunchPaymentConsole(this, InOrderId, AccessToken, SuccessPaymentCallback, PaymentErrorCallback, PaymentBrowserClosedCallback, CachedPaymentTokenRequestPayload.PayStationVersion);
@@ -2099,6 +2212,8 @@ void UXsollaStoreSubsystem::FetchTokenCallback(const FString& AccessToken, int32
 
 void UXsollaStoreSubsystem::BuyVirtualOrFreeItemCallback(int32 InOrderId)
 {
+	JournalPurchase(InOrderId, EXsollaPurchaseJournalState::Created, CachedAuthToken, CachedPurchaseSku);
+
 	FOnStoreSuccessPayment SuccessPaymentCallback;
 	SuccessPaymentCallback.BindDynamic(this, &UXsollaStoreSubsystem::CheckPendingOrderSuccessCallback);
 	CheckPendingOrder(CachedAuthToken, InOrderId, SuccessPaymentCallback, PaymentErrorCallback);
@@ -2112,128 +2227,390 @@ void UXsollaStoreSubsystem::CheckPendingOrderSuccessCallback()
 
 void UXsollaStoreSubsystem::BrowserClosedCallback(bool bIsManually)
 {
+	OnPaymentBrowserClosed(bIsManually);
+}
+
+void UXsollaStoreSubsystem::OnPaymentBrowserClosed(bool bIsManually)
+{
+	// Payment is likely completed by now, so pending orders are checked sooner
+	GetGameInstance()->GetSubsystem<UXsollaOrderPollingSubsystem>()->Expedite();
+
 	PaymentBrowserClosedCallback.ExecuteIfBound(bIsManually);
 	PaymentBrowserClosedCallback.Unbind();
 }
 
-void UXsollaStoreSubsystem::GetVirtualItemsCallback(const FStoreItemsData& InItemsData)
+FString UXsollaStoreSubsystem::GetVirtualItemsUrl(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
+	const int Limit, const int Offset) const
 {
-	GetAllVirtualItemsParams.ProcessNextPartOfData(InItemsData, [this] { CallGetVirtualItems(); });
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/virtual_items"));
+	return XsollaUtilsUrlBuilder(UrlTemplate)
+		.SetPathParam(TEXT("ProjectID"), ProjectID)
+		.AddStringQueryParam(TEXT("locale"), Locale)
+		.AddStringQueryParam(TEXT("country"), Country)
+		.AddArrayQueryParam(TEXT("additional_fields[]"), AdditionalFields)
+		.AddNumberQueryParam(TEXT("limit"), Limit)
+		.AddNumberQueryParam(TEXT("offset"), Offset)
+		.Build();
 }
 
-void UXsollaStoreSubsystem::GetVirtualItemsError(int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage)
+FString UXsollaStoreSubsystem::GetVirtualCurrenciesUrl(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
+	const int Limit, const int Offset) const
 {
-	GetAllVirtualItemsParams.ResultErrorData = FErrorData(StatusCode, ErrorCode, ErrorMessage);
-	GetAllVirtualItemsParams.Finish(false);
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectId}/items/virtual_currency"));
+	return XsollaUtilsUrlBuilder(UrlTemplate)
+		.SetPathParam(TEXT("ProjectId"), ProjectID)
+		.AddStringQueryParam(TEXT("locale"), Locale)
+		.AddStringQueryParam(TEXT("country"), Country)
+		.AddNumberQueryParam(TEXT("limit"), Limit)
+		.AddNumberQueryParam(TEXT("offset"), Offset)
+		.AddArrayQueryParam(TEXT("additional_fields[]"), AdditionalFields)
+		.Build();
 }
 
-void UXsollaStoreSubsystem::CallGetVirtualItems()
+FString UXsollaStoreSubsystem::GetVirtualCurrencyPackagesUrl(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
+	const int Limit, const int Offset) const
 {
-	GetPaginatedVirtualItems(
-		GetAllVirtualItemsParams.Locale,
-		GetAllVirtualItemsParams.Country,
-		GetAllVirtualItemsParams.AdditionalFields,
-		GetAllVirtualItemsParams.CurrentSuccessCallback,
-		GetAllVirtualItemsParams.CurrentErrorCallback,
-		GetAllVirtualItemsParams.Limit,
-		GetAllVirtualItemsParams.Offset,
-		GetAllVirtualItemsParams.AuthToken);
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/virtual_currency/package"));
+	return XsollaUtilsUrlBuilder(UrlTemplate)
+		.SetPathParam(TEXT("ProjectID"), ProjectID)
+		.AddStringQueryParam(TEXT("locale"), Locale)
+		.AddStringQueryParam(TEXT("country"), Country)
+		.AddArrayQueryParam(TEXT("additional_fields[]"), AdditionalFields)
+		.AddNumberQueryParam(TEXT("limit"), Limit)
+		.AddNumberQueryParam(TEXT("offset"), Offset)
+		.Build();
 }
 
-void UXsollaStoreSubsystem::GetVirtualCurrenciesCallback(const FVirtualCurrencyData& InCurrenciesData)
+FString UXsollaStoreSubsystem::GetItemsListBySpecifiedGroupUrl(const FString& ExternalId, const FString& Locale, const FString& Country,
+	const TArray<FString>& AdditionalFields, const int Limit, const int Offset) const
 {
-	GetAllVirtualCurrenciesParams.ProcessNextPartOfData(InCurrenciesData, [this] { CallGetVirtualCurrencies(); });
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/virtual_items/group/{ExternalId}"));
+	return XsollaUtilsUrlBuilder(UrlTemplate)
+		.SetPathParam(TEXT("ProjectID"), ProjectID)
+		.SetPathParam(TEXT("ExternalId"), ExternalId.IsEmpty() ? TEXT("all") : ExternalId)
+		.AddStringQueryParam(TEXT("locale"), Locale)
+		.AddStringQueryParam(TEXT("country"), Country)
+		.AddArrayQueryParam(TEXT("additional_fields[]"), AdditionalFields)
+		.AddNumberQueryParam(TEXT("limit"), Limit)
+		.AddNumberQueryParam(TEXT("offset"), Offset)
+		.Build();
 }
 
-void UXsollaStoreSubsystem::GetVirtualCurrenciesError(int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage)
+FString UXsollaStoreSubsystem::GetBundlesUrl(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
+	const int Limit, const int Offset) const
 {
-	GetAllVirtualCurrenciesParams.ResultErrorData = FErrorData(StatusCode, ErrorCode, ErrorMessage);
-	GetAllVirtualCurrenciesParams.Finish(false);
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/bundle"));
+	return XsollaUtilsUrlBuilder(UrlTemplate)
+		.SetPathParam(TEXT("ProjectID"), ProjectID)
+		.AddStringQueryParam(TEXT("locale"), Locale)
+		.AddStringQueryParam(TEXT("country"), Country)
+		.AddArrayQueryParam(TEXT("additional_fields[]"), AdditionalFields)
+		.AddNumberQueryParam(TEXT("limit"), Limit)
+		.AddNumberQueryParam(TEXT("offset"), Offset)
+		.Build();
 }
 
-void UXsollaStoreSubsystem::CallGetVirtualCurrencies()
+int32 UXsollaStoreSubsystem::GetMaxCatalogPagesInFlight() const
 {
-	GetPaginatedVirtualCurrencies(
-		GetAllVirtualCurrenciesParams.Locale,
-		GetAllVirtualCurrenciesParams.Country,
-		GetAllVirtualCurrenciesParams.AdditionalFields,
-		GetAllVirtualCurrenciesParams.CurrentSuccessCallback,
-		GetAllVirtualCurrenciesParams.CurrentErrorCallback,
-		GetAllVirtualCurrenciesParams.Limit,
-		GetAllVirtualCurrenciesParams.Offset);
+	const UXsollaProjectSettings* Settings = FXsollaSettingsModule::Get().GetSettings();
+	return FMath::Max(Settings->MaxCatalogPagesInFlight, 1);
 }
 
-void UXsollaStoreSubsystem::GetVirtualCurrencyPackagesCallback(const FVirtualCurrencyPackagesData& InCurrencyPackagesData)
+template <typename TPageData>
+void UXsollaStoreSubsystem::RequestCatalogPage(const FString& Url, const FString& AuthToken,
+	const TFunction<void(const TPageData&)>& PageCallback, const FOnError& ErrorCallback)
 {
-	GetAllVirtualCurrencyPackagesParams.ProcessNextPartOfData(InCurrencyPackagesData, [this] { CallGetVirtualCurrencyPackages(); });
+	FOnTokenUpdate SuccessTokenUpdate;
+	SuccessTokenUpdate.BindLambda([&, Url, PageCallback, ErrorCallback, SuccessTokenUpdate](const FString& Token, bool bRepeatOnError)
+	{
+		const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
+		TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
+		XsollaUtilsHttpRequestHelper::EnableResponseCache(HttpRequest);
+		HttpRequest->OnProcessRequestComplete().BindUObject(this, &UXsollaStoreSubsystem::CatalogPage_HttpRequestComplete<TPageData>, PageCallback, ErrorHandlersWrapper);
+		XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest);
+	});
+
+	SuccessTokenUpdate.ExecuteIfBound(AuthToken, true);
 }
 
-void UXsollaStoreSubsystem::GetVirtualCurrencyPackagesError(int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage)
+template <typename TPageData>
+void UXsollaStoreSubsystem::CatalogPage_HttpRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse,
+	const bool bSucceeded, TFunction<void(const TPageData&)> PageCallback, FErrorHandlersWrapper ErrorHandlersWrapper)
 {
-	GetAllVirtualCurrencyPackagesParams.ResultErrorData = FErrorData(StatusCode, ErrorCode, ErrorMessage);
-	GetAllVirtualCurrencyPackagesParams.Finish(false);
+	// Log HTTP response
+	XsollaUtilsLoggingHelper::LogHttpResponse(HttpRequest, HttpResponse);
+
+	XsollaUtilsHttpRequestHelper::ParseResponseAsStructAsync<TPageData>(this, HttpRequest, HttpResponse, bSucceeded,
+		[PageCallback](const TPageData& PageData)
+		{
+			UE_LOG(LogXsollaStore, Log, TEXT("%s: Catalog page received. has_more: %s"), *VA_FUNC_LINE, PageData.has_more ? TEXT("true") : TEXT("false"));
+			PageCallback(PageData);
+		},
+		[this, ErrorHandlersWrapper](const XsollaHttpRequestError& OutError)
+		{
+			LoginSubsystem->HandleRequestError(OutError, ErrorHandlersWrapper);
+		});
 }
 
-void UXsollaStoreSubsystem::CallGetVirtualCurrencyPackages()
+template <typename TParams, typename TPageData>
+void UXsollaStoreSubsystem::StartPaginatedRequest(TMap<FString, TParams>& Requests, const TParams& Params,
+	const TFunction<FString(const TParams&, int32)>& GetPageUrl, const TFunction<void(const FString&, const TParams&)>& UpdateCatalogCallback)
 {
-	GetPaginatedVirtualCurrencyPackages(
-		GetAllVirtualCurrencyPackagesParams.Locale,
-		GetAllVirtualCurrencyPackagesParams.Country,
-		GetAllVirtualCurrencyPackagesParams.AdditionalFields,
-		GetAllVirtualCurrencyPackagesParams.CurrentSuccessCallback,
-		GetAllVirtualCurrencyPackagesParams.CurrentErrorCallback,
-		GetAllVirtualCurrencyPackagesParams.Limit,
-		GetAllVirtualCurrencyPackagesParams.Offset,
-		GetAllVirtualCurrencyPackagesParams.AuthToken);
+	const FString RequestKey = GetPageUrl(Params, Params.Offset) + Params.AuthToken;
+
+	if (TParams* ActiveParams = Requests.Find(RequestKey))
+	{
+		UE_LOG(LogXsollaStore, Log, TEXT("%s: Identical request is in progress, waiting for its result"), *VA_FUNC_LINE);
+		ActiveParams->ResultCallbacks.Append(Params.ResultCallbacks);
+		return;
+	}
+
+	TParams& NewParams = Requests.Add(RequestKey, Params);
+	NewParams.Pagination.Start(NewParams.Limit, NewParams.Offset);
+
+	const int32 RequestId = NewParams.Pagination.RequestId;
+	NewParams.RequestObject = NewObject<UXsollaPaginatedRequestObject>(this);
+	NewParams.RequestObject->OnError.BindWeakLambda(this, [this, &Requests, RequestKey, RequestId](int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage)
+	{
+		TParams* ActiveParams = Requests.Find(RequestKey);
+		if (ActiveParams && ActiveParams->Pagination.RequestId == RequestId)
+		{
+			ActiveParams->ResultErrorData = FErrorData(StatusCode, ErrorCode, ErrorMessage);
+			FinishPaginatedRequest(Requests, RequestKey, false);
+		}
+	});
+	NewParams.CurrentErrorCallback.BindDynamic(NewParams.RequestObject, &UXsollaPaginatedRequestObject::OnPageError);
+
+	RequestNextPages<TParams, TPageData>(Requests, RequestKey, GetPageUrl, UpdateCatalogCallback);
 }
 
-void UXsollaStoreSubsystem::GetAllItemsListBySpecifiedGroupCallback(const FStoreItemsList& InItemsList)
+template <typename TParams, typename TPageData>
+void UXsollaStoreSubsystem::RequestNextPages(TMap<FString, TParams>& Requests, const FString& RequestKey,
+	const TFunction<FString(const TParams&, int32)>& GetPageUrl, const TFunction<void(const FString&, const TParams&)>& UpdateCatalogCallback)
 {
-	GetAllItemsListBySpecifiedGroupParams.ProcessNextPartOfData(InItemsList, [this] { CallGetAllItemsListBySpecifiedGroup(); });
+	TParams* Params = Requests.Find(RequestKey);
+	if (!Params)
+	{
+		return;
+	}
+
+	const int32 RequestId = Params->Pagination.RequestId;
+	Params->Pagination.RequestPages(GetMaxCatalogPagesInFlight(), [this, Params, &Requests, RequestKey, RequestId, &GetPageUrl, &UpdateCatalogCallback](int32 PageOffset)
+	{
+		RequestCatalogPage<TPageData>(GetPageUrl(*Params, PageOffset), Params->AuthToken,
+			[this, &Requests, RequestKey, RequestId, PageOffset, GetPageUrl, UpdateCatalogCallback](const TPageData& PageData)
+			{
+				TParams* ActiveParams = Requests.Find(RequestKey);
+				if (!ActiveParams || ActiveParams->Pagination.RequestId != RequestId)
+				{
+					return;
+				}
+
+				if (ActiveParams->ProcessPartOfData(PageOffset, PageData))
+				{
+					FinishPaginatedRequest(Requests, RequestKey, true, UpdateCatalogCallback);
+				}
+				else
+				{
+					RequestNextPages<TParams, TPageData>(Requests, RequestKey, GetPageUrl, UpdateCatalogCallback);
+				}
+			},
+			Params->CurrentErrorCallback);
+	});
 }
 
-void UXsollaStoreSubsystem::GetAllItemsListBySpecifiedGroupError(int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage)
+template <typename TParams>
+void UXsollaStoreSubsystem::FinishPaginatedRequest(TMap<FString, TParams>& Requests, const FString& RequestKey, const bool bSuccess,
+	const TFunction<void(const FString&, const TParams&)>& UpdateCatalogCallback)
 {
-	GetAllItemsListBySpecifiedGroupParams.ResultErrorData = FErrorData(StatusCode, ErrorCode, ErrorMessage);
-	GetAllItemsListBySpecifiedGroupParams.Finish(false);
+	// Remove the request first, so callbacks can start a new identical one
+	TParams Params;
+	if (Requests.RemoveAndCopyValue(RequestKey, Params))
+	{
+		if (bSuccess && UpdateCatalogCallback)
+		{
+			UpdateCatalogCallback(GetCatalogQueryKey(Params.Locale, Params.Country, Params.AdditionalFields), Params);
+		}
+
+		Params.Pagination.Stop();
+		Params.CurrentErrorCallback.Unbind();
+		Params.ResultCallbacks.Execute(bSuccess, Params.ResultData, Params.ResultErrorData);
+	}
+}
+
+FString UXsollaStoreSubsystem::GetCatalogQueryKey(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields)
+{
+	// Order of additional fields doesn't change the response
+	TArray<FString> SortedFields = AdditionalFields;
+	SortedFields.Sort();
+
+	return FString::Printf(TEXT("%s|%s|%s"), *Locale, *Country, *FString::Join(SortedFields, TEXT(",")));
 }
 
-void UXsollaStoreSubsystem::CallGetAllItemsListBySpecifiedGroup()
+bool UXsollaStoreSubsystem::AcceptCatalogQuery(const FString& QueryKey)
 {
-	GetPaginatedItemsListBySpecifiedGroup(
-		GetAllItemsListBySpecifiedGroupParams.ExternalId,
-		GetAllItemsListBySpecifiedGroupParams.Locale,
-		GetAllItemsListBySpecifiedGroupParams.Country,
-		GetAllItemsListBySpecifiedGroupParams.AdditionalFields,
-		GetAllItemsListBySpecifiedGroupParams.CurrentSuccessCallback,
-		GetAllItemsListBySpecifiedGroupParams.CurrentErrorCallback,
-		GetAllItemsListBySpecifiedGroupParams.Limit,
-		GetAllItemsListBySpecifiedGroupParams.Offset,
-		GetAllItemsListBySpecifiedGroupParams.AuthToken);
+	if (!bHasCatalogQuery)
+	{
+		CatalogQueryKey = QueryKey;
+		bHasCatalogQuery = true;
+	}
+
+	return CatalogQueryKey == QueryKey;
 }
 
-void UXsollaStoreSubsystem::GetBundlesCallback(const FStoreListOfBundles& InBundlesData)
+void UXsollaStoreSubsystem::ResetCatalog()
 {
-	GetAllBundlesParams.ProcessNextPartOfData(InBundlesData, [this] { CallGetBundles(); });
+	CatalogVirtualItems = FStoreItemsData();
+	CatalogVirtualCurrencies = FVirtualCurrencyData();
+	CatalogVirtualCurrencyPackages = FVirtualCurrencyPackagesData();
+	CatalogBundles = FStoreListOfBundles();
+}
+
+void UXsollaStoreSubsystem::UpdateCatalog(const FString& QueryKey, const FStoreItemsData& Data)
+{
+	if (!AcceptCatalogQuery(QueryKey))
+	{
+		return;
+	}
+
+	const bool bChanged = ApplyCatalogDiff<FStoreItem>(CatalogVirtualItems.Items, &CatalogVirtualItems.ItemsIndex, Data.Items,
+		[this](EXsollaCatalogChangeType ChangeType, const FStoreItem& Item)
+		{
+			OnCatalogVirtualItemChanged.Broadcast(ChangeType, Item);
+		});
+
+	if (bChanged)
+	{
+		OnCatalogUpdated.Broadcast();
+	}
 }
 
-void UXsollaStoreSubsystem::GetBundlesError(int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage)
+void UXsollaStoreSubsystem::UpdateCatalog(const FString& QueryKey, const FVirtualCurrencyData& Data)
 {
-	GetAllBundlesParams.ResultErrorData = FErrorData(StatusCode, ErrorCode, ErrorMessage);
-	GetAllBundlesParams.Finish(false);
+	if (!AcceptCatalogQuery(QueryKey))
+	{
+		return;
+	}
+
+	const bool bChanged = ApplyCatalogDiff<FVirtualCurrency>(CatalogVirtualCurrencies.Items, nullptr, Data.Items,
+		[this](EXsollaCatalogChangeType ChangeType, const FVirtualCurrency& Currency)
+		{
+			OnCatalogVirtualCurrencyChanged.Broadcast(ChangeType, Currency);
+		});
+
+	if (bChanged)
+	{
+		OnCatalogUpdated.Broadcast();
+	}
 }
 
-void UXsollaStoreSubsystem::CallGetBundles()
+void UXsollaStoreSubsystem::UpdateCatalog(const FString& QueryKey, const FVirtualCurrencyPackagesData& Data)
 {
-	GetPaginatedBundles(
-		GetAllBundlesParams.Locale,
-		GetAllBundlesParams.Country,
-		GetAllBundlesParams.AdditionalFields,
-		GetAllBundlesParams.CurrentSuccessCallback,
-		GetAllBundlesParams.CurrentErrorCallback,
-		GetAllBundlesParams.Limit,
-		GetAllBundlesParams.Offset,
-		GetAllBundlesParams.AuthToken);
+	if (!AcceptCatalogQuery(QueryKey))
+	{
+		return;
+	}
+
+	const bool bChanged = ApplyCatalogDiff<FVirtualCurrencyPackage>(CatalogVirtualCurrencyPackages.Items, &CatalogVirtualCurrencyPackages.ItemsIndex, Data.Items,
+		[this](EXsollaCatalogChangeType ChangeType, const FVirtualCurrencyPackage& CurrencyPackage)
+		{
+			OnCatalogVirtualCurrencyPackageChanged.Broadcast(ChangeType, CurrencyPackage);
+		});
+
+	if (bChanged)
+	{
+		OnCatalogUpdated.Broadcast();
+	}
+}
+
+void UXsollaStoreSubsystem::UpdateCatalog(const FString& QueryKey, const FStoreListOfBundles& Data)
+{
+	if (!AcceptCatalogQuery(QueryKey))
+	{
+		return;
+	}
+
+	const bool bChanged = ApplyCatalogDiff<FStoreBundle>(CatalogBundles.items, nullptr, Data.items,
+		[this](EXsollaCatalogChangeType ChangeType, const FStoreBundle& Bundle)
+		{
+			OnCatalogBundleChanged.Broadcast(ChangeType, Bundle);
+		});
+
+	if (bChanged)
+	{
+		OnCatalogUpdated.Broadcast();
+	}
+}
+
+template <typename TItem>
+bool UXsollaStoreSubsystem::ApplyCatalogDiff(TArray<TItem>& CatalogItems, TXsollaSkuIndex<TItem>* CatalogIndex, const TArray<TItem>& NewItems,
+	TFunctionRef<void(EXsollaCatalogChangeType, const TItem&)> ChangeCallback)
+{
+	TMap<FString, int32> OldIndices;
+	OldIndices.Reserve(CatalogItems.Num());
+	for (int32 Index = 0; Index < CatalogItems.Num(); ++Index)
+	{
+		OldIndices.Add(CatalogItems[Index].sku, Index);
+	}
+
+	// Pages may overlap if the catalog changes during a fetch, so an SKU is kept once
+	TArray<TItem> UniqueItems;
+	UniqueItems.Reserve(NewItems.Num());
+	TSet<FString> Skus;
+	Skus.Reserve(NewItems.Num());
+	for (const TItem& NewItem : NewItems)
+	{
+		bool bIsAlreadyInSet = false;
+		Skus.Add(NewItem.sku, &bIsAlreadyInSet);
+		if (!bIsAlreadyInSet)
+		{
+			UniqueItems.Add(NewItem);
+		}
+	}
+
+	// Entries are compared property by property, operator== of catalog structs only compares SKUs
+	const UScriptStruct* ItemStruct = TItem::StaticStruct();
+	TArray<TPair<EXsollaCatalogChangeType, int32>> Changes;
+	for (int32 Index = 0; Index < UniqueItems.Num(); ++Index)
+	{
+		int32 OldIndex = INDEX_NONE;
+		if (!OldIndices.RemoveAndCopyValue(UniqueItems[Index].sku, OldIndex))
+		{
+			Changes.Emplace(EXsollaCatalogChangeType::Added, Index);
+		}
+		else if (!ItemStruct->CompareScriptStruct(&CatalogItems[OldIndex], &UniqueItems[Index], PPF_None))
+		{
+			Changes.Emplace(EXsollaCatalogChangeType::Changed, Index);
+		}
+	}
+
+	// Entries left in the map are missing from the new fetch
+	OldIndices.ValueSort(TLess<int32>());
+	TArray<TItem> RemovedItems;
+	RemovedItems.Reserve(OldIndices.Num());
+	for (const auto& OldIndex : OldIndices)
+	{
+		RemovedItems.Add(CatalogItems[OldIndex.Value]);
+	}
+
+	// Order may change without entries changing, so the catalog is always replaced
+	CatalogItems = UniqueItems;
+	if (CatalogIndex)
+	{
+		CatalogIndex->Reset();
+	}
+
+	for (const TItem& RemovedItem : RemovedItems)
+	{
+		ChangeCallback(EXsollaCatalogChangeType::Removed, RemovedItem);
+	}
+
+	for (const auto& Change : Changes)
+	{
+		ChangeCallback(Change.Key, UniqueItems[Change.Value]);
+	}
+
+	return Changes.Num() > 0 || RemovedItems.Num() > 0;
 }
 
 TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UXsollaStoreSubsystem::CreateHttpRequest(const FString& Url, const EXsollaHttpRequestVerb Verb,
@@ -2242,7 +2619,9 @@ TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UXsollaStoreSubsystem::CreateHttpR
 	UE_LOG(LogXsollaStore, Log, TEXT("%s: Creating HTTP request - URL: %s, Verb: %s"),
 		*VA_FUNC_LINE, *Url, *XsollaUtilsLoggingHelper::VerbToString(Verb));
 
-	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = XsollaUtilsHttpRequestHelper::CreateHttpRequest(Url, Verb, AuthToken, Content, TEXT("STORE"), XSOLLA_STORE_VERSION);
+	static const FString SdkModuleName(TEXT("STORE"));
+	static const FString SdkModuleVersion(XSOLLA_STORE_VERSION);
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = XsollaUtilsHttpRequestHelper::CreateHttpRequest(Url, Verb, AuthToken, Content, SdkModuleName, SdkModuleVersion);
 
 	// Log request details
 	XsollaUtilsLoggingHelper::LogHttpRequest(HttpRequest, Content);
@@ -2425,6 +2804,252 @@ bool UXsollaStoreSubsystem::GetSteamUserId(const FString& AuthToken, FString& St
 	return true;
 }
 
+void UXsollaStoreSubsystem::CheckNextOrders(TSharedRef<FXsollaCheckOrdersRequest> Request)
+{
+	if (Request->IsComplete())
+	{
+		// Only pending purchases are journaled, so the journal isn't filled with unrelated orders
+		const TArray<int32> PendingOrderIds = GetPendingOrderIds();
+
+		int32 CompletedCount = 0;
+		for (const auto& Pair : Request->Results.Results)
+		{
+			const bool bIsDone = Pair.Value.OrderStatus == EXsollaOrderStatus::Done;
+			if (bIsDone || Pair.Value.OrderStatus == EXsollaOrderStatus::Canceled)
+			{
+				++CompletedCount;
+				if (PendingOrderIds.Contains(Pair.Key))
+				{
+					JournalPurchase(Pair.Key, bIsDone ? EXsollaPurchaseJournalState::Done : EXsollaPurchaseJournalState::Canceled);
+				}
+			}
+		}
+
+		UE_LOG(LogXsollaStore, Log, TEXT("%s: Orders check complete, %d orders are done or canceled"), *VA_FUNC_LINE, CompletedCount);
+		Request->SuccessCallback.ExecuteIfBound(Request->Results);
+		return;
+	}
+
+	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/order/{OrderId}"));
+
+	while (Request->OrdersInFlight < Request->MaxOrdersInFlight && Request->NextOrderIndex < Request->OrderIds.Num())
+	{
+		const int32 OrderId = Request->OrderIds[Request->NextOrderIndex++];
+		Request->OrdersInFlight++;
+
+		const FString Url = XsollaUtilsUrlBuilder(UrlTemplate)
+								.SetPathParam(TEXT("ProjectID"), ProjectID)
+								.SetPathParam(TEXT("OrderId"), OrderId)
+								.Build();
+
+		// Errors left after token refresh are reported through the dynamic error callback
+		UXsollaCheckOrderRequestObject* RequestObject = NewObject<UXsollaCheckOrderRequestObject>(this);
+		CheckOrderRequestObjects.Add(RequestObject);
+		RequestObject->OnError.BindWeakLambda(this, [this, Request, OrderId, RequestObject](int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage)
+		{
+			FailOrderCheck(Request, OrderId, RequestObject, StatusCode, ErrorCode, ErrorMessage);
+		});
+
+		FOnError ErrorCallback;
+		ErrorCallback.BindDynamic(RequestObject, &UXsollaCheckOrderRequestObject::OnCheckError);
+
+		FOnTokenUpdate SuccessTokenUpdate;
+		SuccessTokenUpdate.BindLambda([&, Url, Request, OrderId, RequestObject, ErrorCallback, SuccessTokenUpdate](const FString& Token, bool bRepeatOnError)
+		{
+			// Orders that aren't sent yet are checked with the refreshed token too
+			Request->AuthToken = Token;
+
+			TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, Token);
+			const auto ErrorHandlersWrapper = FErrorHandlersWrapper(bRepeatOnError, SuccessTokenUpdate, ErrorCallback);
+			HttpRequest->OnProcessRequestComplete().BindUObject(this,
+				&UXsollaStoreSubsystem::CheckOrders_HttpRequestComplete, Request, OrderId, RequestObject, ErrorHandlersWrapper);
+			XsollaUtilsHttpRequestHelper::ProcessRequest(HttpRequest, false);
+		});
+
+		SuccessTokenUpdate.ExecuteIfBound(Request->AuthToken, true);
+	}
+}
+
+void UXsollaStoreSubsystem::FailOrderCheck(TSharedRef<FXsollaCheckOrdersRequest> Request, const int32 OrderId, UXsollaCheckOrderRequestObject* RequestObject,
+	const int32 StatusCode, const int32 ErrorCode, const FString& ErrorMessage)
+{
+	FXsollaOrderCheckResult& Result = Request->Results.Results.Add(OrderId);
+	Result.StatusCode = StatusCode;
+	Result.ErrorCode = ErrorCode;
+	Result.ErrorMessage = ErrorMessage;
+
+	FinishOrderCheck(Request, RequestObject);
+}
+
+void UXsollaStoreSubsystem::FinishOrderCheck(TSharedRef<FXsollaCheckOrdersRequest> Request, UXsollaCheckOrderRequestObject* RequestObject)
+{
+	CheckOrderRequestObjects.Remove(RequestObject);
+
+	Request->OrdersInFlight--;
+	CheckNextOrders(Request);
+}
+
+EXsollaOrderStatus UXsollaStoreSubsystem::ParseOrderStatus(const FXsollaOrder& Order)
+{
+	if (Order.status == TEXT("new"))
+	{
+		return EXsollaOrderStatus::New;
+	}
+	if (Order.status == TEXT("paid"))
+	{
+		return EXsollaOrderStatus::Paid;
+	}
+	if (Order.status == TEXT("done"))
+	{
+		return EXsollaOrderStatus::Done;
+	}
+	if (Order.status == TEXT("canceled"))
+	{
+		return EXsollaOrderStatus::Canceled;
+	}
+
+	UE_LOG(LogXsollaStore, Warning, TEXT("%s: Unknown order status: %s [%d]"), *VA_FUNC_LINE, *Order.status, Order.order_id);
+	return EXsollaOrderStatus::Unknown;
+}
+
+void UXsollaStoreSubsystem::TrackOrder(const FString& AccessToken, const int32 OrderId, const bool bIsUserInvolvedToPayment,
+	const FOnOrderCheckSuccess& SuccessCallback, const FOnError& ErrorCallback)
+{
+	auto OrderCheckObject = NewObject<UXsollaOrderCheckObject>(this);
+
+	FOnOrderCheckSuccess OrderCheckSuccessCallback;
+	OrderCheckSuccessCallback.BindLambda([&, OrderCheckObject, SuccessCallback](int32 CompletedOrderId)
+	{
+		UE_LOG(LogXsollaStore, Log, TEXT("Successful purchase! OrderId = %d"), CompletedOrderId);
+		OrderCheckObject->Destroy();
+		CachedOrderCheckObjects.Remove(OrderCheckObject);
+		JournalPurchase(CompletedOrderId, EXsollaPurchaseJournalState::Done);
+		SuccessCallback.ExecuteIfBound(CompletedOrderId);
+	});
+
+	FOnOrderCheckError OrderCheckErrorCallback;
+	OrderCheckErrorCallback.BindLambda([&, OrderCheckObject, ErrorCallback](int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage)
+	{
+		// Order stays pending in the journal, it's checked again in the next session
+		UE_LOG(LogXsollaStore, Error, TEXT("Order checking failed - Status code: %d, Error code: %d, Error message: %s"), StatusCode, ErrorCode, *ErrorMessage);
+		OrderCheckObject->Destroy();
+		CachedOrderCheckObjects.Remove(OrderCheckObject);
+		ErrorCallback.ExecuteIfBound(StatusCode, ErrorCode, ErrorMessage);
+	});
+
+	JournalPurchase(OrderId, EXsollaPurchaseJournalState::Tracking, AccessToken);
+
+	CachedOrderCheckObjects.Add(OrderCheckObject);
+	OrderCheckObject->Init(AccessToken, OrderId, bIsUserInvolvedToPayment, OrderCheckSuccessCallback, OrderCheckErrorCallback);
+}
+
+void UXsollaStoreSubsystem::JournalPurchase(const int32 OrderId, const EXsollaPurchaseJournalState State,
+	const FString& AccessToken, const FString& Sku)
+{
+	FXsollaPurchaseJournalRecord Record;
+	Record.OrderId = OrderId;
+	Record.State = State;
+	Record.Sku = Sku;
+	Record.Timestamp = FDateTime::UtcNow().ToUnixTimestamp();
+
+	if (!AccessToken.IsEmpty())
+	{
+		const bool bIsUserToken = AccessToken == CachedAuthToken || AccessToken == LoginSubsystem->GetLoginData().AuthToken.JWT;
+		Record.TokenRef = bIsUserToken ? TEXT("user") : TEXT("payment");
+	}
+
+	UXsollaStoreSave::AppendPurchaseRecord(Record);
+}
+
+void UXsollaStoreSubsystem::ResumePendingPurchases()
+{
+	ResumedPurchases = UXsollaStoreSave::LoadPendingPurchases();
+
+	// Orders left unpaid for too long are abandoned, they would otherwise be tracked again in every session
+	const int64 Cutoff = FDateTime::UtcNow().ToUnixTimestamp() - UXsollaStoreSave::PendingPurchaseMaxAge;
+	const int32 AbandonedPurchases = ResumedPurchases.RemoveAll([Cutoff](const FXsollaPurchaseJournalRecord& Purchase)
+	{
+		return Purchase.Timestamp < Cutoff;
+	});
+
+	if (AbandonedPurchases > 0)
+	{
+		UE_LOG(LogXsollaStore, Log, TEXT("%s: Dropped %d abandoned pending purchases"), *VA_FUNC_LINE, AbandonedPurchases);
+	}
+
+	// Completed and abandoned purchases are dropped, so the journal doesn't grow between sessions
+	UXsollaStoreSave::CompactPurchaseJournal(ResumedPurchases);
+
+	if (ResumedPurchases.Num() == 0)
+	{
+		return;
+	}
+
+	// Payment tokens aren't saved, so orders are checked with the user token
+	const FXsollaAuthToken& SavedToken = LoginSubsystem->GetLoginData().AuthToken;
+	const FString AuthToken = SavedToken.JWT;
+	const bool bIsTokenExpired = SavedToken.ExpiresAt > 0 && SavedToken.ExpiresAt <= FDateTime::UtcNow().ToUnixTimestamp();
+	if (AuthToken.IsEmpty() || (bIsTokenExpired && SavedToken.RefreshToken.IsEmpty()))
+	{
+		UE_LOG(LogXsollaStore, Warning, TEXT("%s: %d pending purchases can't be resumed without valid saved user token"), *VA_FUNC_LINE, ResumedPurchases.Num());
+		ResumedPurchases.Empty();
+		return;
+	}
+
+	if (bIsTokenExpired)
+	{
+		// Order checks fail with the expired token, and it's refreshed before they are repeated
+		UE_LOG(LogXsollaStore, Log, TEXT("%s: Saved user token is expired, it will be refreshed by order checks"), *VA_FUNC_LINE);
+	}
+
+	UE_LOG(LogXsollaStore, Log, TEXT("%s: Resuming %d pending purchases"), *VA_FUNC_LINE, ResumedPurchases.Num());
+
+	CachedAuthToken = AuthToken;
+
+	TArray<int32> OrderIds;
+	for (const FXsollaPurchaseJournalRecord& Purchase : ResumedPurchases)
+	{
+		OrderIds.Add(Purchase.OrderId);
+	}
+
+	FOnCheckOrders PendingPurchasesCheckedCallbackDelegate;
+	PendingPurchasesCheckedCallbackDelegate.BindDynamic(this, &UXsollaStoreSubsystem::PendingPurchasesCheckedCallback);
+	CheckOrders(AuthToken, OrderIds, PendingPurchasesCheckedCallbackDelegate);
+}
+
+void UXsollaStoreSubsystem::PendingPurchasesCheckedCallback(const FXsollaOrderCheckResults& OrderCheckResults)
+{
+	// Token may have been refreshed by the order checks
+	CachedAuthToken = LoginSubsystem->GetLoginData().AuthToken.JWT;
+
+	for (const FXsollaPurchaseJournalRecord& Purchase : ResumedPurchases)
+	{
+		const FXsollaOrderCheckResult* Result = OrderCheckResults.Results.Find(Purchase.OrderId);
+		if (!Result || !Result->bSucceeded)
+		{
+			continue;
+		}
+
+		if (Result->OrderStatus == EXsollaOrderStatus::Done)
+		{
+			OnPendingPurchaseCompleted.Broadcast(Purchase.OrderId, Purchase.Sku);
+		}
+		else if (Result->OrderStatus == EXsollaOrderStatus::New || Result->OrderStatus == EXsollaOrderStatus::Paid)
+		{
+			const FString Sku = Purchase.Sku;
+			FOnOrderCheckSuccess OrderCheckSuccessCallback;
+			OrderCheckSuccessCallback.BindLambda([this, Sku](int32 CompletedOrderId)
+			{
+				OnPendingPurchaseCompleted.Broadcast(CompletedOrderId, Sku);
+			});
+
+			TrackOrder(CachedAuthToken, Purchase.OrderId, false, OrderCheckSuccessCallback, FOnError());
+		}
+	}
+
+	ResumedPurchases.Empty();
+}
+
 FString UXsollaStoreSubsystem::GetPayStationVersionPath(const EXsollaPayStationVersion PayStationVersion) const
 {
 	switch (PayStationVersion)
@@ -2507,10 +3132,16 @@ FString UXsollaStoreSubsystem::GetBuildPlatform() const
 
 TArray<FStoreItem> UXsollaStoreSubsystem::GetVirtualItemsWithoutGroup(const FStoreItemsData& StoreItemsData)
 {
-	return StoreItemsData.Items.FilterByPredicate([](const FStoreItem& InStoreItem)
+	const TArray<int32>& Indices = StoreItemsData.ItemsIndex.GetGroupIndices(StoreItemsData.Items, FString());
+
+	TArray<FStoreItem> Items;
+	Items.Reserve(Indices.Num());
+	for (const int32 Index : Indices)
 	{
-		return InStoreItem.groups.Num() == 0;
-	});
+		Items.Add(StoreItemsData.Items[Index]);
+	}
+
+	return Items;
 }
 
 const FString& UXsollaStoreSubsystem::GetPendingPaystationUrl() const
@@ -2520,10 +3151,7 @@ const FString& UXsollaStoreSubsystem::GetPendingPaystationUrl() const
 
 FString UXsollaStoreSubsystem::GetItemName(const FStoreItemsData& StoreItemsData, const FString& ItemSKU)
 {
-	auto StoreItem = StoreItemsData.Items.FindByPredicate([ItemSKU](const FStoreItem& InItem)
-	{
-		return InItem.sku == ItemSKU;
-	});
+	const FStoreItem* StoreItem = StoreItemsData.ItemsIndex.FindBySku(StoreItemsData.Items, ItemSKU);
 
 	if (StoreItem != nullptr)
 	{
@@ -2537,15 +3165,12 @@ const FStoreItem& UXsollaStoreSubsystem::FindItemBySku(const FStoreItemsData& St
 {
 	bHasFound = false;
 
-	const auto StoreItem = StoreItemsData.Items.FindByPredicate([ItemSku](const FStoreItem& InItem)
-	{
-		return InItem.sku == ItemSku;
-	});
+	const FStoreItem* StoreItem = StoreItemsData.ItemsIndex.FindBySku(StoreItemsData.Items, ItemSku);
 
 	if (StoreItem != nullptr)
 	{
 		bHasFound = true;
-		return StoreItem[0];
+		return *StoreItem;
 	}
 
 	static const FStoreItem DefaultItem;
@@ -2557,15 +3182,12 @@ const FVirtualCurrencyPackage& UXsollaStoreSubsystem::FindVirtualCurrencyPackage
 {
 	bHasFound = false;
 
-	const auto PackageItem = VirtualCurrencyPackagesData.Items.FindByPredicate([ItemSku](const FVirtualCurrencyPackage& InItem)
-	{
-		return InItem.sku == ItemSku;
-	});
+	const FVirtualCurrencyPackage* PackageItem = VirtualCurrencyPackagesData.ItemsIndex.FindBySku(VirtualCurrencyPackagesData.Items, ItemSku);
 
 	if (PackageItem != nullptr)
 	{
 		bHasFound = true;
-		return PackageItem[0];
+		return *PackageItem;
 	}
 
 	static const FVirtualCurrencyPackage DefaultPackage;
@@ -2574,11 +3196,7 @@ const FVirtualCurrencyPackage& UXsollaStoreSubsystem::FindVirtualCurrencyPackage
 
 bool UXsollaStoreSubsystem::IsItemInCart(const FStoreCart& Cart, const FString& ItemSKU)
 {
-	auto CartItem = Cart.Items.FindByPredicate([ItemSKU](const FStoreCartItem& InItem) {
-		return InItem.sku == ItemSKU;
-	});
-
-	return CartItem != nullptr;
+	return Cart.ItemsIndex.FindBySku(Cart.Items, ItemSKU) != nullptr;
 }
 
 #if PLATFORM_ANDROID
@@ -0,0 +1,21 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "XsollaCheckOrderRequestObject.generated.h"
+
+DECLARE_DELEGATE_ThreeParams(FOnCheckOrderRequestError, int32, int32, const FString&);
+
+/** Context object of a single order check of CheckOrders. Forwards the check error to the batch that owns it. */
+UCLASS()
+class UXsollaCheckOrderRequestObject : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION()
+	void OnCheckError(int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage);
+
+	FOnCheckOrderRequestError OnError;
+};
@@ -30,7 +30,12 @@ public:
 
 	const FString& GetAccessToken() const;
 
+	int32 GetOrderId() const;
+
 private:
+	friend class UCentrifugoServiceSubsystem;
+	friend class UXsollaOrderPollingSubsystem;
+
 	FOnOrderCheckSuccess OnSuccess;
 
 	FOnOrderCheckError OnError;
@@ -45,11 +50,14 @@ private:
 
 	bool bShortPollingExpired = false;
 
-	void OnConnectionError();
+	/** Whether order status is polled repeatedly, as opposed to a single check. */
+	bool bShortPollingActive = false;
+
+	void OnConnectionLost();
 
-	void OnOrderStatusUpdated(const FOrderStatusData Data);
+	void OnConnectionRestored();
 
-	void OnClosed();
+	void OnOrderStatusUpdated(const FOrderStatusData& Data);
 
 	void OnShortPollingExpired();
 
@@ -0,0 +1,21 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "XsollaPaginatedRequestObject.generated.h"
+
+DECLARE_DELEGATE_ThreeParams(FOnPaginatedRequestError, int32, int32, const FString&);
+
+/** Context object of a single GetAll* request. Forwards page errors to the request that owns it. */
+UCLASS()
+class UXsollaPaginatedRequestObject : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION()
+	void OnPageError(int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage);
+
+	FOnPaginatedRequestError OnError;
+};
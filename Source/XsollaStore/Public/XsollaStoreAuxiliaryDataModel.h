@@ -4,8 +4,164 @@
 
 #include "XsollaStoreDataModel.h"
 #include "XsollaStoreDelegates.h"
+#include "XsollaPaginatedRequestObject.h"
 #include "XsollaStoreAuxiliaryDataModel.generated.h"
 
+/**
+ * Pages of a paginated request that are fetched in parallel.
+ * The API doesn't return the total count, so the first page is requested alone and the following ones
+ * are requested speculatively until a page without `has_more` marks the end of data.
+ */
+template <typename ItemType>
+struct TXsollaPaginatedData
+{
+	int32 RequestId = INDEX_NONE;
+	int32 Limit = 50;
+	int32 StartOffset = 0;
+	int32 NextOffset = 0;
+	int32 EndOffset = MAX_int32;
+	int32 PagesInFlight = 0;
+	TMap<int32, TArray<ItemType>> Pages;
+
+	void Start(const int32 InLimit, const int32 InOffset)
+	{
+		static int32 RequestCounter = 0;
+		RequestId = ++RequestCounter;
+		Limit = InLimit;
+		StartOffset = InOffset;
+		NextOffset = InOffset;
+		EndOffset = MAX_int32;
+		PagesInFlight = 0;
+		Pages.Empty();
+	}
+
+	void Stop()
+	{
+		RequestId = INDEX_NONE;
+		Pages.Empty();
+	}
+
+	bool IsActive() const
+	{
+		return RequestId != INDEX_NONE;
+	}
+
+	/** Requests pages until the in-flight limit or the end of data is reached. */
+	void RequestPages(const int32 MaxPagesInFlight, const TFunction<void(int32)>& RequestPageFunc)
+	{
+		const int32 MaxInFlight = Pages.Num() > 0 ? FMath::Max(MaxPagesInFlight, 1) : 1;
+		while (IsActive() && PagesInFlight < MaxInFlight && NextOffset < EndOffset)
+		{
+			const int32 PageOffset = NextOffset;
+			NextOffset += Limit;
+			PagesInFlight++;
+			RequestPageFunc(PageOffset);
+		}
+	}
+
+	/** Stores received page. Returns true if all pages before the end of data are received. */
+	bool AddPage(const int32 PageOffset, const TArray<ItemType>& Items, const bool bHasMore)
+	{
+		PagesInFlight--;
+
+		if (!bHasMore)
+		{
+			EndOffset = FMath::Min(EndOffset, PageOffset + Limit);
+		}
+
+		if (PageOffset < EndOffset)
+		{
+			Pages.Add(PageOffset, Items);
+		}
+
+		if (EndOffset == MAX_int32)
+		{
+			return false;
+		}
+
+		for (int32 Offset = StartOffset; Offset < EndOffset; Offset += Limit)
+		{
+			if (!Pages.Contains(Offset))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/** Appends received items in offset order. */
+	void AppendItemsTo(TArray<ItemType>& OutItems)
+	{
+		for (int32 Offset = StartOffset; Offset < EndOffset; Offset += Limit)
+		{
+			OutItems.Append(MoveTemp(Pages[Offset]));
+		}
+
+		Pages.Empty();
+	}
+};
+
+/** Callbacks of all callers waiting for a GetAll* request, identical requests are coalesced into one. */
+template <typename SuccessDelegateType>
+struct TXsollaResultCallbacks
+{
+	TArray<SuccessDelegateType> SuccessCallbacks;
+	TArray<FOnError> ErrorCallbacks;
+
+	TXsollaResultCallbacks()
+	{
+	}
+
+	TXsollaResultCallbacks(const SuccessDelegateType& SuccessCallback, const FOnError& ErrorCallback)
+	{
+		SuccessCallbacks.Add(SuccessCallback);
+		ErrorCallbacks.Add(ErrorCallback);
+	}
+
+	void Append(const TXsollaResultCallbacks& Other)
+	{
+		SuccessCallbacks.Append(Other.SuccessCallbacks);
+		ErrorCallbacks.Append(Other.ErrorCallbacks);
+	}
+
+	template <typename DataType>
+	void Execute(const bool bSuccess, const DataType& Data, const FErrorData& ErrorData) const
+	{
+		if (bSuccess)
+		{
+			for (const SuccessDelegateType& SuccessCallback : SuccessCallbacks)
+			{
+				SuccessCallback.ExecuteIfBound(Data);
+			}
+		}
+		else
+		{
+			for (const FOnError& ErrorCallback : ErrorCallbacks)
+			{
+				ErrorCallback.ExecuteIfBound(ErrorData.StatusCode, ErrorData.ErrorCode, ErrorData.ErrorMessage);
+			}
+		}
+	}
+};
+
+/** Orders checked by CheckOrders. Orders are checked in parallel, up to the in-flight limit. */
+struct FXsollaCheckOrdersRequest
+{
+	FString AuthToken;
+	TArray<int32> OrderIds;
+	int32 NextOrderIndex = 0;
+	int32 OrdersInFlight = 0;
+	int32 MaxOrdersInFlight = 1;
+	FXsollaOrderCheckResults Results;
+	FOnCheckOrders SuccessCallback;
+
+	bool IsComplete() const
+	{
+		return NextOrderIndex >= OrderIds.Num() && OrdersInFlight == 0;
+	}
+};
+
 USTRUCT()
 struct FGetAllVirtualItemsParams
 {
@@ -20,11 +176,7 @@ struct FGetAllVirtualItemsParams
 	UPROPERTY()
 	TArray<FString> AdditionalFields;
 
-	UPROPERTY()
-	FOnStoreItemsUpdate ResultSuccessCallback;
-
-	UPROPERTY()
-	FOnError ResultErrorCallback;
+	TXsollaResultCallbacks<FOnStoreItemsUpdate> ResultCallbacks;
 
 	UPROPERTY()
 	FStoreItemsData ResultData;
@@ -32,9 +184,6 @@ struct FGetAllVirtualItemsParams
 	UPROPERTY()
 	FErrorData ResultErrorData;
 
-	UPROPERTY()
-	FOnStoreItemsUpdate CurrentSuccessCallback;
-
 	UPROPERTY()
 	FOnError CurrentErrorCallback;
 
@@ -47,26 +196,22 @@ struct FGetAllVirtualItemsParams
 	UPROPERTY()
 	FString AuthToken;
 
-	void ProcessNextPartOfData(const FStoreItemsData& InItemsData, const TFunction<void()>& NextCallFunc)
-	{
-		ResultData.Items.Append(InItemsData.Items);
+	UPROPERTY()
+	UXsollaPaginatedRequestObject* RequestObject = nullptr;
 
-		if (InItemsData.has_more)
-		{
-			Offset += Limit;
-			NextCallFunc();
-		}
-		else
+	TXsollaPaginatedData<FStoreItem> Pagination;
+
+	/** Stores received page. Returns true if all data is received. */
+	bool ProcessPartOfData(const int32 PageOffset, const FStoreItemsData& InItemsData)
+	{
+		if (Pagination.AddPage(PageOffset, InItemsData.Items, InItemsData.has_more))
 		{
-			Finish(true);
+			Pagination.AppendItemsTo(ResultData.Items);
+			ResultData.ItemsIndex.Reset();
+			return true;
 		}
-	}
 
-	void Finish(bool isSuccess)
-	{
-		CurrentSuccessCallback.Unbind();
-		CurrentErrorCallback.Unbind();
-		isSuccess ? ResultSuccessCallback.ExecuteIfBound(ResultData) : ResultErrorCallback.ExecuteIfBound(ResultErrorData.StatusCode, ResultErrorData.ErrorCode, ResultErrorData.ErrorMessage);
+		return false;
 	}
 
 	FGetAllVirtualItemsParams()
@@ -83,8 +228,7 @@ struct FGetAllVirtualItemsParams
 		: Locale(InLocale)
 		, Country(InCountry)
 		, AdditionalFields(InAdditionalFields)
-		, ResultSuccessCallback(InResultSuccessCallback)
-		, ResultErrorCallback(InResultErrorCallback)
+		, ResultCallbacks(InResultSuccessCallback, InResultErrorCallback)
 		, AuthToken(InAuthToken)
 	{
 	}
@@ -104,11 +248,7 @@ struct FGetAllVirtualCurrenciesParams
 	UPROPERTY()
 	TArray<FString> AdditionalFields;
 
-	UPROPERTY()
-	FOnVirtualCurrenciesUpdate ResultSuccessCallback;
-
-	UPROPERTY()
-	FOnError ResultErrorCallback;
+	TXsollaResultCallbacks<FOnVirtualCurrenciesUpdate> ResultCallbacks;
 
 	UPROPERTY()
 	FVirtualCurrencyData ResultData;
@@ -116,9 +256,6 @@ struct FGetAllVirtualCurrenciesParams
 	UPROPERTY()
 	FErrorData ResultErrorData;
 
-	UPROPERTY()
-	FOnVirtualCurrenciesUpdate CurrentSuccessCallback;
-
 	UPROPERTY()
 	FOnError CurrentErrorCallback;
 
@@ -128,26 +265,24 @@ struct FGetAllVirtualCurrenciesParams
 	UPROPERTY()
 	int32 Offset = 0;
 
-	void ProcessNextPartOfData(const FVirtualCurrencyData& InCurrenciesData, const TFunction<void()>& NextCallFunc)
-	{
-		ResultData.Items.Append(InCurrenciesData.Items);
+	UPROPERTY()
+	FString AuthToken;
 
-		if (InCurrenciesData.has_more)
-		{
-			Offset += Limit;
-			NextCallFunc();
-		}
-		else
+	UPROPERTY()
+	UXsollaPaginatedRequestObject* RequestObject = nullptr;
+
+	TXsollaPaginatedData<FVirtualCurrency> Pagination;
+
+	/** Stores received page. Returns true if all data is received. */
+	bool ProcessPartOfData(const int32 PageOffset, const FVirtualCurrencyData& InCurrenciesData)
+	{
+		if (Pagination.AddPage(PageOffset, InCurrenciesData.Items, InCurrenciesData.has_more))
 		{
-			Finish(true);
+			Pagination.AppendItemsTo(ResultData.Items);
+			return true;
 		}
-	}
 
-	void Finish(bool isSuccess)
-	{
-		CurrentSuccessCallback.Unbind();
-		CurrentErrorCallback.Unbind();
-		isSuccess ? ResultSuccessCallback.ExecuteIfBound(ResultData) : ResultErrorCallback.ExecuteIfBound(ResultErrorData.StatusCode, ResultErrorData.ErrorCode, ResultErrorData.ErrorMessage);
+		return false;
 	}
 
 	FGetAllVirtualCurrenciesParams()
@@ -163,8 +298,7 @@ struct FGetAllVirtualCurrenciesParams
 		: Locale(InLocale)
 		, Country(InCountry)
 		, AdditionalFields(InAdditionalFields)
-		, ResultSuccessCallback(InResultSuccessCallback)
-		, ResultErrorCallback(InResultErrorCallback)
+		, ResultCallbacks(InResultSuccessCallback, InResultErrorCallback)
 	{
 	}
 };
@@ -183,11 +317,7 @@ struct FGetAllVirtualCurrencyPackagesParams
 	UPROPERTY()
 	TArray<FString> AdditionalFields;
 
-	UPROPERTY()
-	FOnVirtualCurrencyPackagesUpdate ResultSuccessCallback;
-
-	UPROPERTY()
-	FOnError ResultErrorCallback;
+	TXsollaResultCallbacks<FOnVirtualCurrencyPackagesUpdate> ResultCallbacks;
 
 	UPROPERTY()
 	FVirtualCurrencyPackagesData ResultData;
@@ -195,9 +325,6 @@ struct FGetAllVirtualCurrencyPackagesParams
 	UPROPERTY()
 	FErrorData ResultErrorData;
 
-	UPROPERTY()
-	FOnVirtualCurrencyPackagesUpdate CurrentSuccessCallback;
-
 	UPROPERTY()
 	FOnError CurrentErrorCallback;
 
@@ -210,26 +337,22 @@ struct FGetAllVirtualCurrencyPackagesParams
 	UPROPERTY()
 	FString AuthToken;
 
-	void ProcessNextPartOfData(const FVirtualCurrencyPackagesData& InCurrencyPackagesData, const TFunction<void()>& NextCallFunc)
-	{
-		ResultData.Items.Append(InCurrencyPackagesData.Items);
+	UPROPERTY()
+	UXsollaPaginatedRequestObject* RequestObject = nullptr;
 
-		if (InCurrencyPackagesData.has_more)
-		{
-			Offset += Limit;
-			NextCallFunc();
-		}
-		else
+	TXsollaPaginatedData<FVirtualCurrencyPackage> Pagination;
+
+	/** Stores received page. Returns true if all data is received. */
+	bool ProcessPartOfData(const int32 PageOffset, const FVirtualCurrencyPackagesData& InCurrencyPackagesData)
+	{
+		if (Pagination.AddPage(PageOffset, InCurrencyPackagesData.Items, InCurrencyPackagesData.has_more))
 		{
-			Finish(true);
+			Pagination.AppendItemsTo(ResultData.Items);
+			ResultData.ItemsIndex.Reset();
+			return true;
 		}
-	}
 
-	void Finish(bool isSuccess)
-	{
-		CurrentSuccessCallback.Unbind();
-		CurrentErrorCallback.Unbind();
-		isSuccess ? ResultSuccessCallback.ExecuteIfBound(ResultData) : ResultErrorCallback.ExecuteIfBound(ResultErrorData.StatusCode, ResultErrorData.ErrorCode, ResultErrorData.ErrorMessage);
+		return false;
 	}
 
 	FGetAllVirtualCurrencyPackagesParams()
@@ -246,8 +369,7 @@ struct FGetAllVirtualCurrencyPackagesParams
 		: Locale(InLocale)
 		, Country(InCountry)
 		, AdditionalFields(InAdditionalFields)
-		, ResultSuccessCallback(InResultSuccessCallback)
-		, ResultErrorCallback(InResultErrorCallback)
+		, ResultCallbacks(InResultSuccessCallback, InResultErrorCallback)
 		, AuthToken(InAuthToken)
 	{
 	}
@@ -270,11 +392,7 @@ struct FGetAllItemsListBySpecifiedGroupParams
 	UPROPERTY()
 	TArray<FString> AdditionalFields;
 
-	UPROPERTY()
-	FOnGetItemsListBySpecifiedGroup ResultSuccessCallback;
-
-	UPROPERTY()
-	FOnError ResultErrorCallback;
+	TXsollaResultCallbacks<FOnGetItemsListBySpecifiedGroup> ResultCallbacks;
 
 	UPROPERTY()
 	FStoreItemsList ResultData;
@@ -282,9 +400,6 @@ struct FGetAllItemsListBySpecifiedGroupParams
 	UPROPERTY()
 	FErrorData ResultErrorData;
 
-	UPROPERTY()
-	FOnGetItemsListBySpecifiedGroup CurrentSuccessCallback;
-
 	UPROPERTY()
 	FOnError CurrentErrorCallback;
 
@@ -297,26 +412,21 @@ struct FGetAllItemsListBySpecifiedGroupParams
 	UPROPERTY()
 	FString AuthToken;
 
-	void ProcessNextPartOfData(const FStoreItemsList& InData, const TFunction<void()>& NextCallFunc)
-	{
-		ResultData.Items.Append(InData.Items);
+	UPROPERTY()
+	UXsollaPaginatedRequestObject* RequestObject = nullptr;
 
-		if (InData.has_more)
-		{
-			Offset += Limit;
-			NextCallFunc();
-		}
-		else
+	TXsollaPaginatedData<FStoreItem> Pagination;
+
+	/** Stores received page. Returns true if all data is received. */
+	bool ProcessPartOfData(const int32 PageOffset, const FStoreItemsList& InData)
+	{
+		if (Pagination.AddPage(PageOffset, InData.Items, InData.has_more))
 		{
-			Finish(true);
+			Pagination.AppendItemsTo(ResultData.Items);
+			return true;
 		}
-	}
 
-	void Finish(bool isSuccess)
-	{
-		CurrentSuccessCallback.Unbind();
-		CurrentErrorCallback.Unbind();
-		isSuccess ? ResultSuccessCallback.ExecuteIfBound(ResultData) : ResultErrorCallback.ExecuteIfBound(ResultErrorData.StatusCode, ResultErrorData.ErrorCode, ResultErrorData.ErrorMessage);
+		return false;
 	}
 
 	FGetAllItemsListBySpecifiedGroupParams()
@@ -335,8 +445,7 @@ struct FGetAllItemsListBySpecifiedGroupParams
 		, Locale(InLocale)
 		, Country(InCountry)
 		, AdditionalFields(InAdditionalFields)
-		, ResultSuccessCallback(InResultSuccessCallback)
-		, ResultErrorCallback(InResultErrorCallback)
+		, ResultCallbacks(InResultSuccessCallback, InResultErrorCallback)
 		, AuthToken(InAuthToken)
 	{
 	}
@@ -356,11 +465,7 @@ struct FGetAllBundlesParams
 	UPROPERTY()
 	TArray<FString> AdditionalFields;
 
-	UPROPERTY()
-	FOnGetListOfBundlesUpdate ResultSuccessCallback;
-
-	UPROPERTY()
-	FOnError ResultErrorCallback;
+	TXsollaResultCallbacks<FOnGetListOfBundlesUpdate> ResultCallbacks;
 
 	UPROPERTY()
 	FStoreListOfBundles ResultData;
@@ -368,9 +473,6 @@ struct FGetAllBundlesParams
 	UPROPERTY()
 	FErrorData ResultErrorData;
 
-	UPROPERTY()
-	FOnGetListOfBundlesUpdate CurrentSuccessCallback;
-
 	UPROPERTY()
 	FOnError CurrentErrorCallback;
 
@@ -383,26 +485,21 @@ struct FGetAllBundlesParams
 	UPROPERTY()
 	FString AuthToken;
 
-	void ProcessNextPartOfData(const FStoreListOfBundles& InData, const TFunction<void()>& NextCallFunc)
-	{
-		ResultData.items.Append(InData.items);
+	UPROPERTY()
+	UXsollaPaginatedRequestObject* RequestObject = nullptr;
 
-		if (InData.has_more)
-		{
-			Offset += Limit;
-			NextCallFunc();
-		}
-		else
+	TXsollaPaginatedData<FStoreBundle> Pagination;
+
+	/** Stores received page. Returns true if all data is received. */
+	bool ProcessPartOfData(const int32 PageOffset, const FStoreListOfBundles& InData)
+	{
+		if (Pagination.AddPage(PageOffset, InData.items, InData.has_more))
 		{
-			Finish(true);
+			Pagination.AppendItemsTo(ResultData.items);
+			return true;
 		}
-	}
 
-	void Finish(bool isSuccess)
-	{
-		CurrentSuccessCallback.Unbind();
-		CurrentErrorCallback.Unbind();
-		isSuccess ? ResultSuccessCallback.ExecuteIfBound(ResultData) : ResultErrorCallback.ExecuteIfBound(ResultErrorData.StatusCode, ResultErrorData.ErrorCode, ResultErrorData.ErrorMessage);
+		return false;
 	}
 
 	FGetAllBundlesParams()
@@ -419,8 +516,7 @@ struct FGetAllBundlesParams
 		: Locale(InLocale)
 		, Country(InCountry)
 		, AdditionalFields(InAdditionalFields)
-		, ResultSuccessCallback(InResultSuccessCallback)
-		, ResultErrorCallback(InResultErrorCallback)
+		, ResultCallbacks(InResultSuccessCallback, InResultErrorCallback)
 		, AuthToken(InAuthToken)
 	{
 	}
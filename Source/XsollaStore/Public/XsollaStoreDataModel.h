@@ -5,6 +5,138 @@
 #include "XsollaUtilsDataModel.h"
 #include "XsollaStoreDataModel.generated.h"
 
+/**
+ * SKU and group lookup index over an item list. Built on the first lookup.
+ * Owners should call Reset() whenever the list is modified. Found entries are checked against the list
+ * and the index is rebuilt if they are stale, so changes made without Reset() don't return wrong items.
+ * It isn't copied together with the owning struct, the copy builds its own index when needed.
+ */
+template <typename ItemType>
+class TXsollaSkuIndex
+{
+public:
+	TXsollaSkuIndex() = default;
+	TXsollaSkuIndex(const TXsollaSkuIndex&) {}
+	TXsollaSkuIndex& operator=(const TXsollaSkuIndex&)
+	{
+		Reset();
+		return *this;
+	}
+
+	/** Returns the first item with the given SKU. */
+	const ItemType* FindBySku(const TArray<ItemType>& Items, const FString& Sku) const
+	{
+		if (!bSkusIndexed)
+		{
+			BuildSkus(Items);
+		}
+
+		const int32* Index = SkuToIndex.Find(Sku);
+		if (Index && !IsSkuAt(Items, *Index, Sku))
+		{
+			BuildSkus(Items);
+			Index = SkuToIndex.Find(Sku);
+		}
+
+		return Index ? &Items[*Index] : nullptr;
+	}
+
+	/** Returns indices of items in the group. Empty group ID returns items that aren't assigned to any group. */
+	const TArray<int32>& GetGroupIndices(const TArray<ItemType>& Items, const FString& GroupId) const
+	{
+		if (!bGroupsIndexed)
+		{
+			BuildGroups(Items);
+		}
+
+		static const TArray<int32> NoIndices;
+		const TArray<int32>* Indices = GroupToIndices.Find(GroupId);
+		if (Indices && !AreInGroup(Items, *Indices, GroupId))
+		{
+			BuildGroups(Items);
+			Indices = GroupToIndices.Find(GroupId);
+		}
+
+		return Indices ? *Indices : NoIndices;
+	}
+
+	void Reset()
+	{
+		SkuToIndex.Empty();
+		GroupToIndices.Empty();
+		bSkusIndexed = false;
+		bGroupsIndexed = false;
+	}
+
+private:
+	static bool IsSkuAt(const TArray<ItemType>& Items, const int32 Index, const FString& Sku)
+	{
+		return Items.IsValidIndex(Index) && Items[Index].sku == Sku;
+	}
+
+	static bool AreInGroup(const TArray<ItemType>& Items, const TArray<int32>& Indices, const FString& GroupId)
+	{
+		for (const int32 Index : Indices)
+		{
+			if (!Items.IsValidIndex(Index))
+			{
+				return false;
+			}
+
+			const auto& Groups = Items[Index].groups;
+			const bool bIsInGroup = GroupId.IsEmpty()
+				? Groups.Num() == 0
+				: Groups.ContainsByPredicate([&GroupId](const auto& Group) { return Group.external_id == GroupId; });
+			if (!bIsInGroup)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void BuildSkus(const TArray<ItemType>& Items) const
+	{
+		SkuToIndex.Reset();
+		SkuToIndex.Reserve(Items.Num());
+		for (int32 Index = 0; Index < Items.Num(); ++Index)
+		{
+			// Keep the first match to behave like a linear search
+			if (!SkuToIndex.Contains(Items[Index].sku))
+			{
+				SkuToIndex.Add(Items[Index].sku, Index);
+			}
+		}
+
+		bSkusIndexed = true;
+	}
+
+	void BuildGroups(const TArray<ItemType>& Items) const
+	{
+		GroupToIndices.Reset();
+		for (int32 Index = 0; Index < Items.Num(); ++Index)
+		{
+			if (Items[Index].groups.Num() == 0)
+			{
+				GroupToIndices.FindOrAdd(FString()).Add(Index);
+			}
+
+			for (const auto& Group : Items[Index].groups)
+			{
+				GroupToIndices.FindOrAdd(Group.external_id).AddUnique(Index);
+			}
+		}
+
+		bGroupsIndexed = true;
+	}
+
+	mutable TMap<FString, int32> SkuToIndex;
+	mutable TMap<FString, TArray<int32>> GroupToIndices;
+	mutable bool bSkusIndexed = false;
+	mutable bool bGroupsIndexed = false;
+};
+
 UENUM(BlueprintType)
 enum class EXsollaOrderStatus : uint8
 {
@@ -15,6 +147,15 @@ enum class EXsollaOrderStatus : uint8
 	Canceled
 };
 
+/** Kind of change of a single catalog entry between two catalog fetches. */
+UENUM(BlueprintType)
+enum class EXsollaCatalogChangeType : uint8
+{
+	Added,
+	Changed,
+	Removed
+};
+
 USTRUCT(BlueprintType)
 struct XSOLLASTORE_API FXsollaOrderItem
 {
@@ -69,6 +210,41 @@ struct XSOLLASTORE_API FXsollaOrder
 	FXsollaOrderContent content;
 };
 
+/** Result of a single order check made by CheckOrders. Error fields are set if the check failed. */
+USTRUCT(BlueprintType)
+struct XSOLLASTORE_API FXsollaOrderCheckResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Order")
+	bool bSucceeded = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Order")
+	EXsollaOrderStatus OrderStatus = EXsollaOrderStatus::Unknown;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Order")
+	FXsollaOrderContent OrderContent;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Order")
+	int32 StatusCode = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Order")
+	int32 ErrorCode = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Order")
+	FString ErrorMessage;
+};
+
+USTRUCT(BlueprintType)
+struct XSOLLASTORE_API FXsollaOrderCheckResults
+{
+	GENERATED_BODY()
+
+	/** Check results by order ID. */
+	UPROPERTY(BlueprintReadOnly, Category = "Order")
+	TMap<int32, FXsollaOrderCheckResult> Results;
+};
+
 USTRUCT(BlueprintType)
 struct XSOLLASTORE_API FStoreBundleContent
 {
@@ -255,6 +431,8 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Items Data")
 	TArray<FStoreItem> Items;
 
+	TXsollaSkuIndex<FStoreItem> ItemsIndex;
+
 public:
 	FStoreItemsData(){};
 };
@@ -456,6 +634,8 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Virtual Currency Packages Data")
 	TArray<FVirtualCurrencyPackage> Items;
 
+	TXsollaSkuIndex<FVirtualCurrencyPackage> ItemsIndex;
+
 public:
 	FVirtualCurrencyPackagesData(){};
 };
@@ -563,6 +743,8 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Cart Data")
 	TArray<FStoreCartItem> Items;
 
+	TXsollaSkuIndex<FStoreCartItem> ItemsIndex;
+
 public:
 	FStoreCart()
 		: is_free(false){};
@@ -11,6 +11,7 @@ DECLARE_DYNAMIC_DELEGATE_OneParam(FOnVirtualCurrenciesUpdate, const FVirtualCurr
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnVirtualCurrencyPackagesUpdate, const FVirtualCurrencyPackagesData&, Data);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnGetItemsListBySpecifiedGroup, const FStoreItemsList&, ItemsList);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnGetListOfBundlesUpdate, const FStoreListOfBundles&, ListOfBundles);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnCheckOrders, const FXsollaOrderCheckResults&, OrderCheckResults);
 
 UCLASS()
 class XSOLLASTORE_API UXsollaStoreDelegates : public UObject
@@ -27,6 +27,38 @@ struct XSOLLASTORE_API FXsollaStoreSaveData
 		, CartCurrency(InCartCurrency){};
 };
 
+/** State of a purchase in the purchase journal. */
+enum class EXsollaPurchaseJournalState : uint8
+{
+	/** Order is created, payment isn't completed yet. */
+	Created,
+	/** Order status is being tracked. */
+	Tracking,
+	Done,
+	Canceled
+};
+
+/** Purchase journal record. Tokens aren't written to disk, only the kind of token used for tracking. */
+struct FXsollaPurchaseJournalRecord
+{
+	int32 OrderId = 0;
+	EXsollaPurchaseJournalState State = EXsollaPurchaseJournalState::Created;
+
+	/** `user` for user authorization token, `payment` for payment token. */
+	FString TokenRef;
+
+	/** Purchased item SKU. Empty for cart purchases and records that don't change it. */
+	FString Sku;
+
+	/** Unix time of the record. Pending purchases returned by the journal have the time of their first record. */
+	int64 Timestamp = 0;
+
+	bool IsPending() const
+	{
+		return State == EXsollaPurchaseJournalState::Created || State == EXsollaPurchaseJournalState::Tracking;
+	}
+};
+
 UCLASS()
 class UXsollaStoreSave : public USaveGame
 {
@@ -36,12 +68,43 @@ public:
 	static FXsollaStoreSaveData Load();
 	static void Save(const FXsollaStoreSaveData& InCartData);
 
+	/**
+	 * Appends record to the purchase journal. The journal is kept in memory and written to its save slot
+	 * asynchronously, so it's cheap enough to be called on every purchase state transition.
+	 * Records of created orders are written right away, other transitions are coalesced.
+	 */
+	static void AppendPurchaseRecord(const FXsollaPurchaseJournalRecord& Record);
+
+	/** Replays the purchase journal and returns the latest state of purchases that are still pending. */
+	static TArray<FXsollaPurchaseJournalRecord> LoadPendingPurchases();
+
+	/** Rewrites the purchase journal so that it contains only the specified records. */
+	static void CompactPurchaseJournal(const TArray<FXsollaPurchaseJournalRecord>& Records);
+
 public:
 	static const FString SaveSlotName;
 
+	/** Slot of the purchase journal. It holds journal text rather than a save game object, so torn records can be skipped. */
+	static const FString PurchaseJournalSlotName;
+
 	/** User index (always 0). */
 	static const int32 UserIndex;
 
+	/** Age (in seconds) after which a pending purchase is considered abandoned and isn't resumed. */
+	static const int64 PendingPurchaseMaxAge;
+
+private:
+	/** Reads the journal from its slot unless it's already in memory. */
+	static void LoadPurchaseJournal();
+	static void SavePurchaseJournal(const bool bWriteNow = false);
+
+	static FString FormatPurchaseRecord(const FXsollaPurchaseJournalRecord& Record);
+	static bool ParsePurchaseRecord(const FString& Line, FXsollaPurchaseJournalRecord& OutRecord);
+
+	/** Journal text, the slot content after pending writes. */
+	static FString PurchaseJournal;
+	static bool bIsPurchaseJournalLoaded;
+
 protected:
 	UPROPERTY()
 	FXsollaStoreSaveData CartData;
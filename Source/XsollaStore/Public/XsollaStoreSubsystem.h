@@ -8,9 +8,11 @@
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "Subsystems/SubsystemCollection.h"
 #include "XsollaOrderCheckObject.h"
+#include "XsollaCheckOrderRequestObject.h"
 #include "XsollaUtilsDataModel.h"
 #include "XsollaStoreDelegates.h"
 #include "XsollaStoreAuxiliaryDataModel.h"
+#include "XsollaStoreSave.h"
 #include "XsollaStoreSubsystem.generated.h"
 
 
@@ -49,6 +51,12 @@ DECLARE_DYNAMIC_DELEGATE_OneParam(FOnSubscriptionsListUpdate, FSubscriptionsList
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnGetSubscriptionDetailsSuccess, const FSubscriptionDetails&, SubscriptionDetails);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FOnGetSubscriptionPayStationLinkSuccess, const FString&, LinkToPaystation);
 DECLARE_DYNAMIC_DELEGATE(FOnCancelSubscriptionSuccess);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCatalogVirtualItemChanged, EXsollaCatalogChangeType, ChangeType, const FStoreItem&, Item);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCatalogVirtualCurrencyChanged, EXsollaCatalogChangeType, ChangeType, const FVirtualCurrency&, Currency);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCatalogVirtualCurrencyPackageChanged, EXsollaCatalogChangeType, ChangeType, const FVirtualCurrencyPackage&, CurrencyPackage);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCatalogBundleChanged, EXsollaCatalogChangeType, ChangeType, const FStoreBundle&, Bundle);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCatalogUpdated);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPendingPurchaseCompleted, int32, OrderId, const FString&, Sku);
 
 UCLASS()
 class XSOLLASTORE_API UXsollaStoreSubsystem : public UGameInstanceSubsystem
@@ -71,6 +79,62 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Xsolla|Store")
 	void Initialize(const FString& InProjectId);
 
+	/**
+	 * Sets request parameters of catalog fetches that update the subsystem-owned catalog. Fetches with other parameters
+	 * (e.g. another locale) don't update it and don't fire catalog events. If not set, parameters of the first complete
+	 * catalog fetch are used. Changing parameters clears the catalog.
+	 *
+	 * @param Locale Response language. Leave empty to use the default value.
+	 * @param Country Country used to calculate regional prices and restrictions. Leave empty to use the default value.
+	 * @param AdditionalFields The list of additional fields.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Xsolla|Store|Catalog", meta = (AutoCreateRefTerm = "AdditionalFields"))
+	void SetCatalogQuery(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields);
+
+	/** Returns virtual items received by the latest successful GetVirtualItems call with catalog query parameters. */
+	UFUNCTION(BlueprintPure, Category = "Xsolla|Store|Catalog")
+	const FStoreItemsData& GetCatalogVirtualItems() const;
+
+	/** Returns virtual currencies received by the latest successful GetVirtualCurrencies call with catalog query parameters. */
+	UFUNCTION(BlueprintPure, Category = "Xsolla|Store|Catalog")
+	const FVirtualCurrencyData& GetCatalogVirtualCurrencies() const;
+
+	/** Returns virtual currency packages received by the latest successful GetVirtualCurrencyPackages call with catalog query parameters. */
+	UFUNCTION(BlueprintPure, Category = "Xsolla|Store|Catalog")
+	const FVirtualCurrencyPackagesData& GetCatalogVirtualCurrencyPackages() const;
+
+	/** Returns bundles received by the latest successful GetBundles call with catalog query parameters. */
+	UFUNCTION(BlueprintPure, Category = "Xsolla|Store|Catalog")
+	const FStoreListOfBundles& GetCatalogBundles() const;
+
+	/** Called for each virtual item added, changed or removed by a GetVirtualItems call. */
+	UPROPERTY(BlueprintAssignable, Category = "Xsolla|Store|Catalog")
+	FOnCatalogVirtualItemChanged OnCatalogVirtualItemChanged;
+
+	/** Called for each virtual currency added, changed or removed by a GetVirtualCurrencies call. */
+	UPROPERTY(BlueprintAssignable, Category = "Xsolla|Store|Catalog")
+	FOnCatalogVirtualCurrencyChanged OnCatalogVirtualCurrencyChanged;
+
+	/** Called for each virtual currency package added, changed or removed by a GetVirtualCurrencyPackages call. */
+	UPROPERTY(BlueprintAssignable, Category = "Xsolla|Store|Catalog")
+	FOnCatalogVirtualCurrencyPackageChanged OnCatalogVirtualCurrencyPackageChanged;
+
+	/** Called for each bundle added, changed or removed by a GetBundles call. */
+	UPROPERTY(BlueprintAssignable, Category = "Xsolla|Store|Catalog")
+	FOnCatalogBundleChanged OnCatalogBundleChanged;
+
+	/** Called after per-entry events if a catalog fetch changed anything. */
+	UPROPERTY(BlueprintAssignable, Category = "Xsolla|Store|Catalog")
+	FOnCatalogUpdated OnCatalogUpdated;
+
+	/** Called when a purchase left pending in the previous session (e.g. the game was closed during payment) is completed. SKU is empty for cart purchases. */
+	UPROPERTY(BlueprintAssignable, Category = "Xsolla|Store")
+	FOnPendingPurchaseCompleted OnPendingPurchaseCompleted;
+
+	/** Removes catalog responses cached on disk. The next catalog requests will download complete data. */
+	UFUNCTION(BlueprintCallable, Category = "Xsolla|Store")
+	void ClearCatalogCache();
+
 	/** Returns a list of virtual items according to pagination settings. The list includes items which are set to be available for purchase in the store. For each virtual item, complete data is returned.
 	 * <b>Attention:</b> The number of items returned in a single response is limited. <b>The default and maximum value is 50 items per response</b>. To get more data page by page, use <code>Limit</code> and <code>Offset</code> fields.
 	 * [More about the use cases](https://developers.xsolla.com/sdk/unreal-engine/catalog/catalog-display/).
@@ -325,6 +389,35 @@ public:
 	void CheckPendingOrder(const FString& AccessToken, const int32 OrderId,
 		const FOnStoreSuccessPayment& SuccessCallback, const FOnError& ErrorCallback, bool bIsUserInvolvedToPayment = false);
 
+	/** Checks statuses of several orders, e.g. to reconcile pending orders after the game was restarted.
+	 * Orders are checked in parallel with a limited number of requests in flight. Checked orders that are done or canceled
+	 * are removed from the pending orders.
+	 *
+	 * @param AuthToken User authorization token obtained during authorization using Xsolla Login ([more about authorization options](https://developers.xsolla.com/sdk/unreal-engine/authentication/)).
+	 * @param OrderIds Identifiers of orders.
+	 * @param SuccessCallback Called after all orders are checked. Contains the result of each order, including failed checks.
+	 * @param MaxRequestsInFlight Maximum number of order check requests sent in parallel.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Xsolla|Store", meta = (AutoCreateRefTerm = "SuccessCallback"))
+	void CheckOrders(const FString& AuthToken, const TArray<int32>& OrderIds,
+		const FOnCheckOrders& SuccessCallback, const int32 MaxRequestsInFlight = 4);
+
+	/** Returns identifiers of orders that are created or tracked but not completed yet, according to the purchase journal.
+	 * The journal is kept between sessions. Pending purchases are resumed at startup if the user token is saved,
+	 * otherwise the orders can be passed to CheckOrders after authorization.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Xsolla|Store")
+	TArray<int32> GetPendingOrderIds() const;
+
+	/** Opens connection for order status updates in advance, e.g. when the store UI is opened, so that purchase confirmation
+	 * doesn't wait for the connection handshake. The connection is reused for all purchases during the session.
+	 * Requires `KeepCentrifugoConnection` to be enabled in the project settings.
+	 *
+	 * @param AuthToken User authorization token obtained during authorization using Xsolla Login ([more about authorization options](https://developers.xsolla.com/sdk/unreal-engine/authentication/)).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Xsolla|Store")
+	void PreconnectOrderTracking(const FString& AuthToken);
+
 	/** Create order with specified free item. The created order will get a `done` order status.
 	 * [More about the use cases](https://developers.xsolla.com/sdk/unreal-engine/promo/free-items/).
 	 *
@@ -844,6 +937,9 @@ protected:
 		const bool bSucceeded, FOnFetchTokenSuccess SuccessCallback, FErrorHandlersWrapper ErrorHandlersWrapper);
 	void CheckOrder_HttpRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse,
 		const bool bSucceeded, FOnCheckOrder SuccessCallback, FOnError ErrorCallback);
+	void CheckOrders_HttpRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse,
+		const bool bSucceeded, TSharedRef<FXsollaCheckOrdersRequest> Request, const int32 OrderId,
+		UXsollaCheckOrderRequestObject* RequestObject, FErrorHandlersWrapper ErrorHandlersWrapper);
 
 	void CreateOrderWithSpecifiedFreeItem_HttpRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse,
 		const bool bSucceeded, FOnPurchaseUpdate SuccessCallback, FErrorHandlersWrapper ErrorHandlersWrapper);
@@ -946,52 +1042,75 @@ protected:
 	void CheckPendingOrderSuccessCallback();
 
 	UFUNCTION()
-	void BrowserClosedCallback(bool bIsManually);
+	void PendingPurchasesCheckedCallback(const FXsollaOrderCheckResults& OrderCheckResults);
 
-	// virtual items
 	UFUNCTION()
-	void GetVirtualItemsCallback(const FStoreItemsData& InItemsData);
+	void BrowserClosedCallback(bool bIsManually);
 
-	UFUNCTION()
-	void GetVirtualItemsError(int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage);
+	/** Expedites order polling and calls payment browser closed callback. */
+	void OnPaymentBrowserClosed(bool bIsManually);
 
-	void CallGetVirtualItems();
+	FString GetVirtualItemsUrl(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
+		const int Limit, const int Offset) const;
 
-	// virtual currencies
-	UFUNCTION()
-	void GetVirtualCurrenciesCallback(const FVirtualCurrencyData& InCurrenciesData);
+	FString GetVirtualCurrenciesUrl(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
+		const int Limit, const int Offset) const;
 
-	UFUNCTION()
-	void GetVirtualCurrenciesError(int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage);
+	FString GetVirtualCurrencyPackagesUrl(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
+		const int Limit, const int Offset) const;
 
-	void CallGetVirtualCurrencies();
+	FString GetItemsListBySpecifiedGroupUrl(const FString& ExternalId, const FString& Locale, const FString& Country,
+		const TArray<FString>& AdditionalFields, const int Limit, const int Offset) const;
 
-	// virtual currency packages
-	UFUNCTION()
-	void GetVirtualCurrencyPackagesCallback(const FVirtualCurrencyPackagesData& InPackagesData);
+	FString GetBundlesUrl(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields,
+		const int Limit, const int Offset) const;
 
-	UFUNCTION()
-	void GetVirtualCurrencyPackagesError(int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage);
+	/** Max number of pages requested in parallel by the GetAll* methods (e.g. GetVirtualItems). */
+	int32 GetMaxCatalogPagesInFlight() const;
 
-	void CallGetVirtualCurrencyPackages();
+	/** Starts a GetAll* request or attaches callbacks to an identical one in progress. */
+	template <typename TParams, typename TPageData>
+	void StartPaginatedRequest(TMap<FString, TParams>& Requests, const TParams& Params,
+		const TFunction<FString(const TParams&, int32)>& GetPageUrl, const TFunction<void(const FString&, const TParams&)>& UpdateCatalogCallback = nullptr);
 
-	// items by specified group
-	UFUNCTION()
-	void GetAllItemsListBySpecifiedGroupCallback(const FStoreItemsList& InItemsList);
+	template <typename TParams, typename TPageData>
+	void RequestNextPages(TMap<FString, TParams>& Requests, const FString& RequestKey,
+		const TFunction<FString(const TParams&, int32)>& GetPageUrl, const TFunction<void(const FString&, const TParams&)>& UpdateCatalogCallback);
 
-	UFUNCTION()
-	void GetAllItemsListBySpecifiedGroupError(int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage);
+	/** Calls result callbacks of the request. UpdateCatalogCallback, if any, gets the catalog query key and the complete result on success. */
+	template <typename TParams>
+	void FinishPaginatedRequest(TMap<FString, TParams>& Requests, const FString& RequestKey, const bool bSuccess,
+		const TFunction<void(const FString&, const TParams&)>& UpdateCatalogCallback = nullptr);
 
-	void CallGetAllItemsListBySpecifiedGroup();
+	/** Requests a single page of a paginated catalog request. */
+	template <typename TPageData>
+	void RequestCatalogPage(const FString& Url, const FString& AuthToken,
+		const TFunction<void(const TPageData&)>& PageCallback, const FOnError& ErrorCallback);
 
-	// bundles
-	UFUNCTION()
-	void GetBundlesCallback(const FStoreListOfBundles& InBundlesData);
+	template <typename TPageData>
+	void CatalogPage_HttpRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse,
+		const bool bSucceeded, TFunction<void(const TPageData&)> PageCallback, FErrorHandlersWrapper ErrorHandlersWrapper);
 
-	UFUNCTION()
-	void GetBundlesError(int32 StatusCode, int32 ErrorCode, const FString& ErrorMessage);
+	static FString GetCatalogQueryKey(const FString& Locale, const FString& Country, const TArray<FString>& AdditionalFields);
+
+	/** Whether a fetch with the given query updates the catalog. The first query is adopted if none is set. */
+	bool AcceptCatalogQuery(const FString& QueryKey);
+
+	/** Applies a complete catalog fetch to the subsystem-owned catalog. Data of another query is ignored. */
+	void UpdateCatalog(const FString& QueryKey, const FStoreItemsData& Data);
+	void UpdateCatalog(const FString& QueryKey, const FVirtualCurrencyData& Data);
+	void UpdateCatalog(const FString& QueryKey, const FVirtualCurrencyPackagesData& Data);
+	void UpdateCatalog(const FString& QueryKey, const FStoreListOfBundles& Data);
 
-	void CallGetBundles();
+	void ResetCatalog();
+
+	/**
+	 * Replaces catalog entries with new ones and calls ChangeCallback for each added, changed or removed entry. Returns true if anything changed.
+	 * Only the first of new entries with the same SKU is kept. CatalogIndex, if any, is reset before callbacks are called.
+	 */
+	template <typename TItem>
+	bool ApplyCatalogDiff(TArray<TItem>& CatalogItems, TXsollaSkuIndex<TItem>* CatalogIndex, const TArray<TItem>& NewItems,
+		TFunctionRef<void(EXsollaCatalogChangeType, const TItem&)> ChangeCallback);
 
 private:
 	/** Create http request and add Xsolla API meta */
@@ -1007,6 +1126,27 @@ private:
 	/** Prepare paystation settings */
 	TSharedPtr<FJsonObject> PreparePaystationSettings(const bool bAddAdditionalParameters = false, const bool bDisableSdkParameter = false, const bool bShowCloseButton = false, const FString& CloseButtonIcon = TEXT("cross"), const bool bGpQuickPaymentButton = false, const bool bUseSteamOverlayForDesktop = false);
 
+	/** Sends order check requests until the in-flight limit is reached, or calls the callback once all orders are checked. */
+	void CheckNextOrders(TSharedRef<FXsollaCheckOrdersRequest> Request);
+
+	/** Records failed order check and continues the batch. */
+	void FailOrderCheck(TSharedRef<FXsollaCheckOrdersRequest> Request, const int32 OrderId, UXsollaCheckOrderRequestObject* RequestObject,
+		const int32 StatusCode, const int32 ErrorCode, const FString& ErrorMessage);
+	void FinishOrderCheck(TSharedRef<FXsollaCheckOrdersRequest> Request, UXsollaCheckOrderRequestObject* RequestObject);
+
+	static EXsollaOrderStatus ParseOrderStatus(const FXsollaOrder& Order);
+
+	/** Creates order tracker that is removed once the order is completed. */
+	void TrackOrder(const FString& AccessToken, const int32 OrderId, const bool bIsUserInvolvedToPayment,
+		const FOnOrderCheckSuccess& SuccessCallback, const FOnError& ErrorCallback);
+
+	/** Appends purchase state transition to the purchase journal. */
+	void JournalPurchase(const int32 OrderId, const EXsollaPurchaseJournalState State,
+		const FString& AccessToken = FString(), const FString& Sku = FString());
+
+	/** Checks purchases left pending in the previous session and resumes tracking of the ones that aren't completed. */
+	void ResumePendingPurchases();
+
 	/** Extract Steam user ID from auth token */
 	bool GetSteamUserId(const FString& AuthToken, FString& SteamId, FString& OutError);
 
@@ -1085,6 +1225,10 @@ private:
 	UPROPERTY()
 	TArray<UXsollaOrderCheckObject*> CachedOrderCheckObjects;
 
+	/** Context objects of order checks of CheckOrders in progress. */
+	UPROPERTY(Transient)
+	TArray<UXsollaCheckOrderRequestObject*> CheckOrderRequestObjects;
+
 	UPROPERTY()
 	UXsollaLoginSubsystem* LoginSubsystem;
 
@@ -1100,6 +1244,12 @@ private:
 	UPROPERTY()
 	int32 PaymentOrderId;
 
+	/** SKU of the item being purchased, empty for cart purchases */
+	FString CachedPurchaseSku;
+
+	/** Purchases from the previous session that are being checked */
+	TArray<FXsollaPurchaseJournalRecord> ResumedPurchases;
+
 	UPROPERTY()
 	int32 PaymentPayStationVersionNumber;
 
@@ -1112,18 +1262,27 @@ private:
 	UPROPERTY()
 	FOnStoreBrowserClosed PaymentBrowserClosedCallback;
 
+	/** GetAll* requests in progress by request key. Identical requests share the same entry. */
 	UPROPERTY(Transient)
-	FGetAllVirtualItemsParams GetAllVirtualItemsParams;
+	TMap<FString, FGetAllVirtualItemsParams> GetAllVirtualItemsRequests;
 
 	UPROPERTY(Transient)
-	FGetAllVirtualCurrenciesParams GetAllVirtualCurrenciesParams;
+	TMap<FString, FGetAllVirtualCurrenciesParams> GetAllVirtualCurrenciesRequests;
 
 	UPROPERTY(Transient)
-	FGetAllVirtualCurrencyPackagesParams GetAllVirtualCurrencyPackagesParams;
+	TMap<FString, FGetAllVirtualCurrencyPackagesParams> GetAllVirtualCurrencyPackagesRequests;
 
 	UPROPERTY(Transient)
-	FGetAllItemsListBySpecifiedGroupParams GetAllItemsListBySpecifiedGroupParams;
+	TMap<FString, FGetAllItemsListBySpecifiedGroupParams> GetAllItemsListBySpecifiedGroupRequests;
 
 	UPROPERTY(Transient)
-	FGetAllBundlesParams GetAllBundlesParams;
+	TMap<FString, FGetAllBundlesParams> GetAllBundlesRequests;
+
+	/** Canonical catalog copies updated by complete catalog fetches with the catalog query. */
+	FString CatalogQueryKey;
+	bool bHasCatalogQuery = false;
+	FStoreItemsData CatalogVirtualItems;
+	FVirtualCurrencyData CatalogVirtualCurrencies;
+	FVirtualCurrencyPackagesData CatalogVirtualCurrencyPackages;
+	FStoreListOfBundles CatalogBundles;
 };
@@ -0,0 +1,66 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "XsollaUtilsHttpRequestHelper.h"
+
+BEGIN_DEFINE_SPEC(FHttpRequestHelperSpec, "Xsolla.Utils.HttpRequestHelper",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FHttpRequestHelperSpec)
+
+void FHttpRequestHelperSpec::Define()
+{
+	Describe("CreateHttpRequest", [this]()
+	{
+		It("should add analytics meta to URL and headers", [this]()
+		{
+			const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = XsollaUtilsHttpRequestHelper::CreateHttpRequest(
+				TEXT("https://store.xsolla.com/api/v2/items"), EXsollaHttpRequestVerb::VERB_GET, FString(), FString(), TEXT("STORE"), TEXT("1.0.0"));
+
+			TestTrue("URL query", Request->GetURL().StartsWith(TEXT("https://store.xsolla.com/api/v2/items?engine=ue")));
+			TestTrue("SDK query", Request->GetURL().Contains(TEXT("&sdk=store&sdk_v=1.0.0&"), ESearchCase::CaseSensitive));
+			TestEqual("SDK header", Request->GetHeader(TEXT("X-SDK")), TEXT("STORE"));
+			TestEqual("SDK version header", Request->GetHeader(TEXT("X-SDK-V")), TEXT("1.0.0"));
+		});
+
+		It("should append meta to existing query", [this]()
+		{
+			const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = XsollaUtilsHttpRequestHelper::CreateHttpRequest(
+				TEXT("https://store.xsolla.com/api/v2/items?limit=50"), EXsollaHttpRequestVerb::VERB_GET, FString(), FString(), TEXT("STORE"), TEXT("1.0.0"));
+
+			TestTrue("URL query", Request->GetURL().StartsWith(TEXT("https://store.xsolla.com/api/v2/items?limit=50&engine=ue")));
+		});
+
+		It("should keep meta of different modules apart", [this]()
+		{
+			const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> StoreRequest = XsollaUtilsHttpRequestHelper::CreateHttpRequest(
+				TEXT("https://store.xsolla.com"), EXsollaHttpRequestVerb::VERB_GET, FString(), FString(), TEXT("STORE"), TEXT("1.0.0"));
+			const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> LoginRequest = XsollaUtilsHttpRequestHelper::CreateHttpRequest(
+				TEXT("https://login.xsolla.com"), EXsollaHttpRequestVerb::VERB_GET, FString(), FString(), TEXT("LOGIN"), TEXT("2.0.0"));
+
+			TestEqual("Store SDK header", StoreRequest->GetHeader(TEXT("X-SDK")), TEXT("STORE"));
+			TestEqual("Login SDK header", LoginRequest->GetHeader(TEXT("X-SDK")), TEXT("LOGIN"));
+			TestEqual("Login SDK version header", LoginRequest->GetHeader(TEXT("X-SDK-V")), TEXT("2.0.0"));
+		});
+
+		It("should create the same request with precomputed and rebuilt meta", [this]()
+		{
+			const FString Url(TEXT("https://store.xsolla.com/api/v2/project/1/items/virtual_items?limit=50"));
+
+			XsollaUtilsHttpRequestHelper::CreateHttpRequest(Url, EXsollaHttpRequestVerb::VERB_GET, TEXT("token"), FString(), TEXT("STORE"), TEXT("1.0.0"));
+			const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CachedMetaRequest = XsollaUtilsHttpRequestHelper::CreateHttpRequest(
+				Url, EXsollaHttpRequestVerb::VERB_GET, TEXT("token"), FString(), TEXT("STORE"), TEXT("1.0.0"));
+
+			XsollaUtilsHttpRequestHelper::InvalidateRequestMeta();
+			const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> RebuiltMetaRequest = XsollaUtilsHttpRequestHelper::CreateHttpRequest(
+				Url, EXsollaHttpRequestVerb::VERB_GET, TEXT("token"), FString(), TEXT("STORE"), TEXT("1.0.0"));
+
+			TestEqual("URL", CachedMetaRequest->GetURL(), RebuiltMetaRequest->GetURL());
+			TestEqual("Headers", FString::Join(CachedMetaRequest->GetAllHeaders(), TEXT("\n")), FString::Join(RebuiltMetaRequest->GetAllHeaders(), TEXT("\n")));
+		});
+	});
+}
+
+#endif
@@ -0,0 +1,410 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#include "XsollaUtilsHttpCache.h"
+#include "XsollaUtilsDefines.h"
+#include "XsollaUtilsTokenParser.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/SecureHash.h"
+
+static const FString ETagMetaPrefix(TEXT("ETag: "));
+static const FString LastModifiedMetaPrefix(TEXT("Last-Modified: "));
+
+XsollaUtilsHttpCache::XsollaUtilsHttpCache()
+	: bEnabled(true)
+	, LastWriteId(0)
+	, ClearGeneration(0)
+{
+}
+
+XsollaUtilsHttpCache& XsollaUtilsHttpCache::Get()
+{
+	static XsollaUtilsHttpCache Instance;
+	return Instance;
+}
+
+void XsollaUtilsHttpCache::SetEnabled(const bool bInEnabled)
+{
+	bEnabled = bInEnabled;
+}
+
+bool XsollaUtilsHttpCache::IsEnabled() const
+{
+	return bEnabled;
+}
+
+void XsollaUtilsHttpCache::PrepareRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest)
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	const FString Key = GetCacheKey(HttpRequest);
+
+	FScopeLock Lock(&EntriesLock);
+
+	const FCacheEntry* Entry = FindOrLoadEntry(Key);
+	if (!Entry)
+	{
+		// Register the request so its response will be stored
+		Entries.Add(Key, FCacheEntry());
+		return;
+	}
+
+	if (!Entry->ETag.IsEmpty())
+	{
+		HttpRequest->SetHeader(TEXT("If-None-Match"), Entry->ETag);
+	}
+
+	if (!Entry->LastModified.IsEmpty())
+	{
+		HttpRequest->SetHeader(TEXT("If-Modified-Since"), Entry->LastModified);
+	}
+}
+
+bool XsollaUtilsHttpCache::TryGetNotModifiedContent(const FHttpRequestPtr& HttpRequest, const FHttpResponsePtr& HttpResponse, FString& OutContent)
+{
+	FString Key;
+	if (!IsNotModified(HttpRequest, HttpResponse, Key))
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&EntriesLock);
+
+	FCacheEntry* Entry = Entries.Find(Key);
+	if (!Entry)
+	{
+		return false;
+	}
+
+	if (!Entry->bContentLoaded && Entry->PendingResponse.IsValid())
+	{
+		// Body isn't on disk yet
+		Entry->Content = Entry->PendingResponse->GetContentAsString();
+		Entry->bContentLoaded = true;
+	}
+
+	if (!Entry->bContentLoaded)
+	{
+		if (!FFileHelper::LoadFileToString(Entry->Content, *GetContentPath(Key)))
+		{
+			UE_LOG(LogXsollaUtils, Warning, TEXT("%s: Can't load cached response for %s"), *VA_FUNC_LINE, *HttpRequest->GetURL());
+			RemoveEntry(Key);
+			return false;
+		}
+
+		Entry->bContentLoaded = true;
+	}
+
+	UE_LOG(LogXsollaUtils, Verbose, TEXT("%s: Response not modified, using cached content for %s"), *VA_FUNC_LINE, *HttpRequest->GetURL());
+	OutContent = Entry->Content;
+	return true;
+}
+
+bool XsollaUtilsHttpCache::NeedsUnconditionalRetry(const FHttpRequestPtr& HttpRequest, const FHttpResponsePtr& HttpResponse)
+{
+	if (!HttpRequest.IsValid() || !HttpResponse.IsValid() || HttpResponse->GetResponseCode() != EHttpResponseCodes::NotModified)
+	{
+		return false;
+	}
+
+	if (HttpRequest->GetHeader(TEXT("If-None-Match")).IsEmpty() && HttpRequest->GetHeader(TEXT("If-Modified-Since")).IsEmpty())
+	{
+		return false;
+	}
+
+	if (!bEnabled)
+	{
+		return true;
+	}
+
+	const FString Key = GetCacheKey(HttpRequest);
+
+	FScopeLock Lock(&EntriesLock);
+
+	const FCacheEntry* Entry = Entries.Find(Key);
+	if (Entry && (Entry->bContentLoaded || Entry->PendingResponse.IsValid() || Entry->ConvertedStruct.IsValid()
+		|| IFileManager::Get().FileExists(*GetContentPath(Key))))
+	{
+		return false;
+	}
+
+	Entries.Add(Key, FCacheEntry());
+	return true;
+}
+
+bool XsollaUtilsHttpCache::TryGetNotModifiedStruct(const FHttpRequestPtr& HttpRequest, const FHttpResponsePtr& HttpResponse, const UStruct* StructDefinition, void* OutStruct)
+{
+	FString Key;
+	if (!IsNotModified(HttpRequest, HttpResponse, Key))
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&EntriesLock);
+
+	const FCacheEntry* Entry = Entries.Find(Key);
+	if (!Entry || !Entry->ConvertedStruct.IsValid() || Entry->ConvertedStruct->GetStruct() != StructDefinition)
+	{
+		return false;
+	}
+
+	const UScriptStruct* ScriptStruct = Cast<UScriptStruct>(StructDefinition);
+	if (!ScriptStruct)
+	{
+		return false;
+	}
+
+	UE_LOG(LogXsollaUtils, Verbose, TEXT("%s: Response not modified, using cached struct for %s"), *VA_FUNC_LINE, *HttpRequest->GetURL());
+	ScriptStruct->CopyScriptStruct(OutStruct, Entry->ConvertedStruct->GetStructMemory());
+	return true;
+}
+
+void XsollaUtilsHttpCache::StoreResponse(const FHttpRequestPtr& HttpRequest, const FHttpResponsePtr& HttpResponse, const FString& Content)
+{
+	FScopeLock Lock(&EntriesLock);
+
+	FString Key;
+	FCacheEntry* Entry = UpdateEntry(HttpRequest, HttpResponse, Key);
+	if (!Entry)
+	{
+		return;
+	}
+
+	Entry->Content = Content;
+	Entry->bContentLoaded = true;
+
+	WriteEntryAsync(Key, *Entry, [Content](const FString& ContentPath)
+	{
+		return FFileHelper::SaveStringToFile(Content, *ContentPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	});
+}
+
+void XsollaUtilsHttpCache::StoreResponse(const FHttpRequestPtr& HttpRequest, const FHttpResponsePtr& HttpResponse)
+{
+	FScopeLock Lock(&EntriesLock);
+
+	FString Key;
+	FCacheEntry* Entry = UpdateEntry(HttpRequest, HttpResponse, Key);
+	if (!Entry)
+	{
+		return;
+	}
+
+	// Response keeps its content alive until the write is done, `304 Not Modified` may arrive before that
+	Entry->PendingResponse = HttpResponse;
+
+	FHttpResponsePtr Response = HttpResponse;
+	WriteEntryAsync(Key, *Entry, [Response](const FString& ContentPath)
+	{
+		return FFileHelper::SaveArrayToFile(Response->GetContent(), *ContentPath);
+	});
+}
+
+void XsollaUtilsHttpCache::StoreStruct(const FHttpRequestPtr& HttpRequest, const UStruct* StructDefinition, const void* Struct)
+{
+	const UScriptStruct* ScriptStruct = Cast<UScriptStruct>(StructDefinition);
+	if (!bEnabled || !HttpRequest.IsValid() || !ScriptStruct)
+	{
+		return;
+	}
+
+	const FString Key = GetCacheKey(HttpRequest);
+
+	FScopeLock Lock(&EntriesLock);
+
+	FCacheEntry* Entry = Entries.Find(Key);
+	if (!Entry || (Entry->ETag.IsEmpty() && Entry->LastModified.IsEmpty()))
+	{
+		return;
+	}
+
+	TSharedPtr<FStructOnScope> ConvertedStruct = MakeShared<FStructOnScope>(ScriptStruct);
+	ScriptStruct->CopyScriptStruct(ConvertedStruct->GetStructMemory(), Struct);
+	Entry->ConvertedStruct = ConvertedStruct;
+}
+
+void XsollaUtilsHttpCache::Clear()
+{
+	FScopeLock Lock(&EntriesLock);
+
+	Entries.Empty();
+
+	{
+		FScopeLock FilesLock(&WriteLock);
+		++ClearGeneration;
+		IFileManager::Get().DeleteDirectory(*GetCacheDir(), false, true);
+	}
+
+	UE_LOG(LogXsollaUtils, Log, TEXT("%s: HTTP response cache cleared"), *VA_FUNC_LINE);
+}
+
+FString XsollaUtilsHttpCache::GetCacheKey(const FHttpRequestPtr& HttpRequest) const
+{
+	// Personalized responses are shared between tokens of the same user, so token rotation doesn't invalidate the cache
+	FString UserScope;
+	FString AuthHeader = HttpRequest->GetHeader(TEXT("Authorization"));
+	if (AuthHeader.RemoveFromStart(TEXT("Bearer ")))
+	{
+		if (!UXsollaUtilsTokenParser::GetStringTokenParam(AuthHeader, TEXT("sub"), UserScope))
+		{
+			UserScope = FMD5::HashAnsiString(*AuthHeader);
+		}
+	}
+
+	return FMD5::HashAnsiString(*FString::Printf(TEXT("%s|%s|%s"), *HttpRequest->GetVerb(), *HttpRequest->GetURL(), *UserScope));
+}
+
+FString XsollaUtilsHttpCache::GetCacheDir() const
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Xsolla"), TEXT("HttpCache"));
+}
+
+FString XsollaUtilsHttpCache::GetContentPath(const FString& Key) const
+{
+	return FPaths::Combine(GetCacheDir(), Key + TEXT(".json"));
+}
+
+FString XsollaUtilsHttpCache::GetMetaPath(const FString& Key) const
+{
+	return FPaths::Combine(GetCacheDir(), Key + TEXT(".meta"));
+}
+
+XsollaUtilsHttpCache::FCacheEntry* XsollaUtilsHttpCache::FindOrLoadEntry(const FString& Key)
+{
+	if (FCacheEntry* Entry = Entries.Find(Key))
+	{
+		return Entry;
+	}
+
+	TArray<FString> Meta;
+	if (!FFileHelper::LoadFileToStringArray(Meta, *GetMetaPath(Key)) || Meta.Num() == 0 || !IFileManager::Get().FileExists(*GetContentPath(Key)))
+	{
+		return nullptr;
+	}
+
+	FCacheEntry Entry;
+	for (FString& Line : Meta)
+	{
+		if (Line.RemoveFromStart(ETagMetaPrefix))
+		{
+			Entry.ETag = Line;
+		}
+		else if (Line.RemoveFromStart(LastModifiedMetaPrefix))
+		{
+			Entry.LastModified = Line;
+		}
+	}
+
+	if (Entry.ETag.IsEmpty() && Entry.LastModified.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	return &Entries.Add(Key, MoveTemp(Entry));
+}
+
+bool XsollaUtilsHttpCache::IsNotModified(const FHttpRequestPtr& HttpRequest, const FHttpResponsePtr& HttpResponse, FString& OutKey) const
+{
+	if (!bEnabled || !HttpRequest.IsValid() || !HttpResponse.IsValid() || HttpResponse->GetResponseCode() != EHttpResponseCodes::NotModified)
+	{
+		return false;
+	}
+
+	OutKey = GetCacheKey(HttpRequest);
+	return true;
+}
+
+XsollaUtilsHttpCache::FCacheEntry* XsollaUtilsHttpCache::UpdateEntry(const FHttpRequestPtr& HttpRequest, const FHttpResponsePtr& HttpResponse, FString& OutKey)
+{
+	if (!bEnabled || !HttpRequest.IsValid() || !HttpResponse.IsValid() || HttpResponse->GetResponseCode() != EHttpResponseCodes::Ok)
+	{
+		return nullptr;
+	}
+
+	const FString ETag = HttpResponse->GetHeader(TEXT("ETag"));
+	const FString LastModified = HttpResponse->GetHeader(TEXT("Last-Modified"));
+
+	OutKey = GetCacheKey(HttpRequest);
+
+	FCacheEntry* Entry = Entries.Find(OutKey);
+	if (!Entry)
+	{
+		return nullptr;
+	}
+
+	if (ETag.IsEmpty() && LastModified.IsEmpty())
+	{
+		// Server doesn't support conditional requests for this resource, keep the request registered only
+		*Entry = FCacheEntry();
+		return nullptr;
+	}
+
+	// Same validators mean the same representation, the stored body is still valid
+	if (Entry->ETag == ETag && Entry->LastModified == LastModified)
+	{
+		return nullptr;
+	}
+
+	Entry->ETag = ETag;
+	Entry->LastModified = LastModified;
+	Entry->Content.Empty();
+	Entry->bContentLoaded = false;
+	Entry->PendingResponse.Reset();
+	Entry->ConvertedStruct.Reset();
+	return Entry;
+}
+
+void XsollaUtilsHttpCache::RemoveEntry(const FString& Key)
+{
+	Entries.Remove(Key);
+	IFileManager::Get().Delete(*GetMetaPath(Key), false, false, true);
+	IFileManager::Get().Delete(*GetContentPath(Key), false, false, true);
+}
+
+void XsollaUtilsHttpCache::WriteEntryAsync(const FString& Key, FCacheEntry& Entry, TFunction<bool(const FString& ContentPath)> WriteContent)
+{
+	Entry.WriteId = ++LastWriteId;
+
+	const uint64 WriteId = Entry.WriteId;
+	const uint32 Generation = ClearGeneration;
+	const FString ContentPath = GetContentPath(Key);
+	const FString MetaPath = GetMetaPath(Key);
+	const TArray<FString> Meta = {ETagMetaPrefix + Entry.ETag, LastModifiedMetaPrefix + Entry.LastModified};
+
+	// Write on a worker thread, catalog responses can be large
+	Async(EAsyncExecution::ThreadPool, [this, Key, WriteId, Generation, ContentPath, MetaPath, Meta, WriteContent = MoveTemp(WriteContent)]()
+	{
+		bool bIsWritten = false;
+		{
+			FScopeLock FilesLock(&WriteLock);
+			if (Generation != ClearGeneration)
+			{
+				return;
+			}
+
+			// Content is written first so validators never point to a missing body
+			bIsWritten = WriteContent(ContentPath) && FFileHelper::SaveStringArrayToFile(Meta, *MetaPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+		}
+
+		if (!bIsWritten)
+		{
+			// Pending response stays in memory and serves `304 Not Modified` for this session
+			UE_LOG(LogXsollaUtils, Warning, TEXT("%s: Can't write cached response %s"), *VA_FUNC_LINE, *ContentPath);
+			return;
+		}
+
+		FScopeLock Lock(&EntriesLock);
+
+		FCacheEntry* WrittenEntry = Entries.Find(Key);
+		if (WrittenEntry && WrittenEntry->WriteId == WriteId)
+		{
+			WrittenEntry->PendingResponse.Reset();
+		}
+	});
+}
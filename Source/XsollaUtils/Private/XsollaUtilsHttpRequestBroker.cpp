@@ -0,0 +1,217 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#include "XsollaUtilsHttpRequestBroker.h"
+#include "XsollaUtilsDefines.h"
+#include "XsollaUtilsHttpCache.h"
+#include "Async/Async.h"
+
+XsollaUtilsHttpRequestBroker::XsollaUtilsHttpRequestBroker()
+	: CoalescingWindow(0.f)
+{
+}
+
+XsollaUtilsHttpRequestBroker& XsollaUtilsHttpRequestBroker::Get()
+{
+	static XsollaUtilsHttpRequestBroker Instance;
+	return Instance;
+}
+
+void XsollaUtilsHttpRequestBroker::SetCoalescingWindow(const float InSeconds)
+{
+	CoalescingWindow = FMath::Max(InSeconds, 0.f);
+
+	if (CoalescingWindow == 0.f)
+	{
+		CompletedRequests.Empty();
+	}
+}
+
+float XsollaUtilsHttpRequestBroker::GetCoalescingWindow() const
+{
+	return CoalescingWindow;
+}
+
+void XsollaUtilsHttpRequestBroker::ProcessRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest, const bool bAllowRecentResponse)
+{
+	// Bookkeeping isn't synchronized, requests from other threads are sent as is
+	if (HttpRequest->GetVerb() != TEXT("GET") || !IsInGameThread())
+	{
+		HttpRequest->ProcessRequest();
+		return;
+	}
+
+	const FString RequestKey = GetRequestKey(HttpRequest);
+
+	if (CoalescingWindow > 0.f && bAllowRecentResponse)
+	{
+		RemoveExpiredResponses(FPlatformTime::Seconds());
+
+		if (const FCompletedRequest* CompletedRequest = CompletedRequests.Find(RequestKey))
+		{
+			UE_LOG(LogXsollaUtils, Verbose, TEXT("%s: Reusing recent response for %s"), *VA_FUNC_LINE, *HttpRequest->GetURL());
+
+			// Completion is deferred to keep callers' expectations of an asynchronous request
+			FHttpResponsePtr HttpResponse = CompletedRequest->HttpResponse;
+			AsyncTask(ENamedThreads::GameThread, [HttpRequest, HttpResponse]()
+			{
+				HttpRequest->OnProcessRequestComplete().ExecuteIfBound(HttpRequest, HttpResponse, true);
+			});
+			return;
+		}
+	}
+
+	if (TArray<TSharedRef<IHttpRequest, ESPMode::ThreadSafe>>* Waiters = InFlightRequests.Find(RequestKey))
+	{
+		UE_LOG(LogXsollaUtils, Verbose, TEXT("%s: Attaching to request in flight %s"), *VA_FUNC_LINE, *HttpRequest->GetURL());
+		Waiters->Add(HttpRequest);
+		return;
+	}
+
+	InFlightRequests.Add(RequestKey);
+
+	const FHttpRequestCompleteDelegate OriginalDelegate = HttpRequest->OnProcessRequestComplete();
+	HttpRequest->OnProcessRequestComplete().BindRaw(this, &XsollaUtilsHttpRequestBroker::OnRequestComplete, RequestKey, OriginalDelegate);
+	HttpRequest->ProcessRequest();
+}
+
+FString XsollaUtilsHttpRequestBroker::GetRequestKey(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest) const
+{
+	// Requests with different validators may get different status codes (200 or 304), so they can't share a response
+	return FString::Printf(TEXT("%s|%s|%s|%s|%s"), *HttpRequest->GetVerb(), *HttpRequest->GetURL(), *HttpRequest->GetHeader(TEXT("Authorization")),
+		*HttpRequest->GetHeader(TEXT("If-None-Match")), *HttpRequest->GetHeader(TEXT("If-Modified-Since")));
+}
+
+bool XsollaUtilsHttpRequestBroker::ReadSharedStruct(const FHttpResponsePtr& HttpResponse, const UStruct* StructDefinition, void* OutStruct, TFunctionRef<bool()> ReadStruct)
+{
+	const UScriptStruct* ScriptStruct = Cast<UScriptStruct>(StructDefinition);
+
+	TSharedPtr<FSharedResponse, ESPMode::ThreadSafe> SharedResponse;
+	if (HttpResponse.IsValid() && ScriptStruct)
+	{
+		FScopeLock Lock(&SharedResponsesLock);
+
+		const TSharedRef<FSharedResponse, ESPMode::ThreadSafe>* Found = SharedResponses.Find(HttpResponse.Get());
+		if (Found && (*Found)->HttpResponse.Pin() == HttpResponse)
+		{
+			SharedResponse = *Found;
+		}
+	}
+
+	if (!SharedResponse.IsValid())
+	{
+		return ReadStruct();
+	}
+
+	FScopeLock Lock(&SharedResponse->Lock);
+
+	if (SharedResponse->DecodedStruct.IsValid() && SharedResponse->DecodedStruct->GetStruct() == ScriptStruct)
+	{
+		ScriptStruct->CopyScriptStruct(OutStruct, SharedResponse->DecodedStruct->GetStructMemory());
+		return true;
+	}
+
+	if (!ReadStruct())
+	{
+		return false;
+	}
+
+	TSharedPtr<FStructOnScope> DecodedStruct = MakeShared<FStructOnScope>(ScriptStruct);
+	ScriptStruct->CopyScriptStruct(DecodedStruct->GetStructMemory(), OutStruct);
+	SharedResponse->DecodedStruct = DecodedStruct;
+	return true;
+}
+
+void XsollaUtilsHttpRequestBroker::OnRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded,
+	FString RequestKey, FHttpRequestCompleteDelegate OriginalDelegate)
+{
+	if (bSucceeded && XsollaUtilsHttpCache::Get().NeedsUnconditionalRetry(HttpRequest, HttpResponse))
+	{
+		UE_LOG(LogXsollaUtils, Verbose, TEXT("%s: Cached response is gone, requesting %s without validators"), *VA_FUNC_LINE, *HttpRequest->GetURL());
+
+		// Handlers and waiters get the full response as if it was the response to the original request
+		const TSharedRef<IHttpRequest, ESPMode::ThreadSafe> RetryRequest = CreateUnconditionalRequest(HttpRequest);
+		RetryRequest->OnProcessRequestComplete().BindLambda([this, HttpRequest, RequestKey, OriginalDelegate](FHttpRequestPtr, FHttpResponsePtr RetryResponse, const bool bRetrySucceeded)
+		{
+			OnRequestComplete(HttpRequest, RetryResponse, bRetrySucceeded, RequestKey, OriginalDelegate);
+		});
+		RetryRequest->ProcessRequest();
+		return;
+	}
+
+	TArray<TSharedRef<IHttpRequest, ESPMode::ThreadSafe>> Waiters;
+	InFlightRequests.RemoveAndCopyValue(RequestKey, Waiters);
+
+	if (CoalescingWindow > 0.f && bSucceeded && HttpResponse.IsValid() && EHttpResponseCodes::IsOk(HttpResponse->GetResponseCode()))
+	{
+		FCompletedRequest& CompletedRequest = CompletedRequests.Add(RequestKey);
+		CompletedRequest.HttpResponse = HttpResponse;
+		CompletedRequest.CompletionTime = FPlatformTime::Seconds();
+	}
+
+	if (HttpResponse.IsValid() && (Waiters.Num() > 0 || CompletedRequests.Contains(RequestKey)))
+	{
+		AddSharedResponse(HttpResponse);
+	}
+
+	OriginalDelegate.ExecuteIfBound(HttpRequest, HttpResponse, bSucceeded);
+
+	// Each waiter gets its own request object, so handlers can't tell the response is shared
+	for (const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Waiter : Waiters)
+	{
+		Waiter->OnProcessRequestComplete().ExecuteIfBound(Waiter, HttpResponse, bSucceeded);
+	}
+}
+
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> XsollaUtilsHttpRequestBroker::CreateUnconditionalRequest(const FHttpRequestPtr& HttpRequest)
+{
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> RetryRequest = FHttpModule::Get().CreateRequest();
+	RetryRequest->SetURL(HttpRequest->GetURL());
+	RetryRequest->SetVerb(HttpRequest->GetVerb());
+
+	for (const FString& Header : HttpRequest->GetAllHeaders())
+	{
+		FString Name;
+		FString Value;
+		if (Header.Split(TEXT(": "), &Name, &Value)
+			&& !Name.Equals(TEXT("If-None-Match"), ESearchCase::IgnoreCase)
+			&& !Name.Equals(TEXT("If-Modified-Since"), ESearchCase::IgnoreCase))
+		{
+			RetryRequest->SetHeader(Name, Value);
+		}
+	}
+
+	return RetryRequest;
+}
+
+void XsollaUtilsHttpRequestBroker::RemoveExpiredResponses(const double Now)
+{
+	for (auto It = CompletedRequests.CreateIterator(); It; ++It)
+	{
+		if (Now - It.Value().CompletionTime > CoalescingWindow)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void XsollaUtilsHttpRequestBroker::AddSharedResponse(const FHttpResponsePtr& HttpResponse)
+{
+	FScopeLock Lock(&SharedResponsesLock);
+
+	// Responses are released together with requests, so entries are pruned here instead of tracking all of them
+	for (auto It = SharedResponses.CreateIterator(); It; ++It)
+	{
+		if (!It.Value()->HttpResponse.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	const TSharedRef<FSharedResponse, ESPMode::ThreadSafe>* Found = SharedResponses.Find(HttpResponse.Get());
+	if (!Found || (*Found)->HttpResponse.Pin() != HttpResponse)
+	{
+		TSharedRef<FSharedResponse, ESPMode::ThreadSafe> SharedResponse = MakeShared<FSharedResponse, ESPMode::ThreadSafe>();
+		SharedResponse->HttpResponse = HttpResponse;
+		SharedResponses.Add(HttpResponse.Get(), SharedResponse);
+	}
+}
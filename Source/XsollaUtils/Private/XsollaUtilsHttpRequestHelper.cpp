@@ -1,6 +1,10 @@
 // Copyright 2024 Xsolla Inc. All Rights Reserved.
 
 #include "XsollaUtilsHttpRequestHelper.h"
+#include "XsollaUtilsDefines.h"
+#include "XsollaUtilsHttpCache.h"
+#include "XsollaUtilsHttpRequestBroker.h"
+#include "XsollaUtilsJsonStructReader.h"
 #include "XsollaUtilsLibrary.h"
 #include "Kismet/GameplayStatics.h"
 #include "Dom/JsonObject.h"
@@ -8,12 +12,16 @@
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Misc/EngineVersion.h"
+#include "Misc/ScopeLock.h"
 
 const FString XsollaUtilsHttpRequestHelper::NoResponseErrorMsg(TEXT("No response"));
 const FString XsollaUtilsHttpRequestHelper::UnknownErrorMsg(TEXT("Unknown error"));
 const FString XsollaUtilsHttpRequestHelper::DeserializationErrorMsg(TEXT("Failed to deserialize response"));
 const FString XsollaUtilsHttpRequestHelper::ConversionErrorMsg(TEXT("Failed to convert response"));
 
+TArray<XsollaUtilsHttpRequestHelper::FRequestMetaEntry> XsollaUtilsHttpRequestHelper::RequestMetaCache;
+FCriticalSection XsollaUtilsHttpRequestHelper::RequestMetaCacheLock;
+
 TSharedRef<IHttpRequest, ESPMode::ThreadSafe> XsollaUtilsHttpRequestHelper::CreateHttpRequest(const FString& Url,
 	const FString& Verb,
 	const FString& AuthToken,
@@ -23,42 +31,22 @@ TSharedRef<IHttpRequest, ESPMode::ThreadSafe> XsollaUtilsHttpRequestHelper::Crea
 {
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
 
-	// Referral analytics meta
-	FString XRef = TEXT("");
-	FString XRefV = TEXT("");
-
-	UXsollaUtilsLibrary::GetPartnerInfo(XRef, XRefV);
+	const TSharedRef<const FRequestMeta, ESPMode::ThreadSafe> Meta = GetRequestMeta(SdkModuleName, SdkModuleVersion);
 
-	bool IsReferralAnalyticsSet = !XRef.IsEmpty() && !XRefV.IsEmpty();
+	// Xsolla and referral analytics URL meta
+	int32 QueryStart = INDEX_NONE;
+	FString MetaUrl;
+	MetaUrl.Reserve(Url.Len() + Meta->UrlQuery.Len() + 1);
+	MetaUrl += Url;
+	MetaUrl.AppendChar(Url.FindChar(TEXT('?'), QueryStart) ? TEXT('&') : TEXT('?'));
+	MetaUrl += Meta->UrlQuery;
 
-	FString Engine = FString::Printf(TEXT("ue%d"), FEngineVersion::Current().GetMajor());
+	HttpRequest->SetURL(MetaUrl);
 
-	// Xsolla analytics URL meta
-	const FString MetaUrl = FString::Printf(TEXT("%sengine=%s&engine_v=%s&sdk=%s&sdk_v=%s&build_platform=%s"),
-		Url.Contains(TEXT("?")) ? TEXT("&") : TEXT("?"),
-		*Engine,
-		ENGINE_VERSION_STRING,
-		*SdkModuleName.ToLower(),
-		*SdkModuleVersion,
-		*UGameplayStatics::GetPlatformName().ToLower());
-
-	// Referral analytics URL meta
-	const FString ReferralMetaUrl = IsReferralAnalyticsSet ? FString::Printf(TEXT("&ref=%s&ref_v=%s"), *XRef.ToLower(), *XRefV.ToLower()) : TEXT("");
-
-	HttpRequest->SetURL(Url + MetaUrl + ReferralMetaUrl);
-
-	// Xsolla analytics header meta
-	HttpRequest->SetHeader(TEXT("X-ENGINE"), Engine.ToUpper());
-	HttpRequest->SetHeader(TEXT("X-ENGINE-V"), ENGINE_VERSION_STRING);
-	HttpRequest->SetHeader(TEXT("X-SDK"), SdkModuleName);
-	HttpRequest->SetHeader(TEXT("X-SDK-V"), SdkModuleVersion);
-	HttpRequest->SetHeader(TEXT("X-BUILD-PLATFORM"), UGameplayStatics::GetPlatformName());
-
-	// Referral analytics header meta
-	if (IsReferralAnalyticsSet)
+	// Xsolla and referral analytics header meta
+	for (const TPair<FString, FString>& Header : Meta->Headers)
 	{
-		HttpRequest->SetHeader(TEXT("X-REF"), XRef);
-		HttpRequest->SetHeader(TEXT("X-REF-V"), XRefV);
+		HttpRequest->SetHeader(Header.Key, Header.Value);
 	}
 
 	if (!Verb.IsEmpty())
@@ -68,7 +56,7 @@ TSharedRef<IHttpRequest, ESPMode::ThreadSafe> XsollaUtilsHttpRequestHelper::Crea
 
 	if (!AuthToken.IsEmpty())
 	{
-		HttpRequest->SetHeader(TEXT("Authorization"), FString::Printf(TEXT("Bearer %s"), *AuthToken));
+		HttpRequest->SetHeader(TEXT("Authorization"), TEXT("Bearer ") + AuthToken);
 	}
 
 	if (!Content.IsEmpty())
@@ -113,6 +101,80 @@ FString XsollaUtilsHttpRequestHelper::GetVerbAsString(const EXsollaHttpRequestVe
 	return VerbAsString;
 }
 
+void XsollaUtilsHttpRequestHelper::InvalidateRequestMeta()
+{
+	FScopeLock Lock(&RequestMetaCacheLock);
+	RequestMetaCache.Empty();
+}
+
+TSharedRef<const XsollaUtilsHttpRequestHelper::FRequestMeta, ESPMode::ThreadSafe> XsollaUtilsHttpRequestHelper::GetRequestMeta(const FString& SdkModuleName,
+	const FString& SdkModuleVersion)
+{
+	FScopeLock Lock(&RequestMetaCacheLock);
+
+	// Module name is sent as is in the header, so it's matched case-sensitively
+	for (const FRequestMetaEntry& Entry : RequestMetaCache)
+	{
+		if (Entry.SdkModuleName.Equals(SdkModuleName, ESearchCase::CaseSensitive) && Entry.SdkModuleVersion.Equals(SdkModuleVersion, ESearchCase::CaseSensitive))
+		{
+			return Entry.Meta;
+		}
+	}
+
+	// Referral analytics meta
+	FString XRef;
+	FString XRefV;
+	UXsollaUtilsLibrary::GetPartnerInfo(XRef, XRefV);
+
+	const bool IsReferralAnalyticsSet = !XRef.IsEmpty() && !XRefV.IsEmpty();
+
+	const FString Engine = FString::Printf(TEXT("ue%d"), FEngineVersion::Current().GetMajor());
+	const FString PlatformName = UGameplayStatics::GetPlatformName();
+
+	TSharedRef<FRequestMeta, ESPMode::ThreadSafe> Meta = MakeShared<FRequestMeta, ESPMode::ThreadSafe>();
+
+	// Xsolla analytics URL meta
+	Meta->UrlQuery = FString::Printf(TEXT("engine=%s&engine_v=%s&sdk=%s&sdk_v=%s&build_platform=%s"),
+		*Engine,
+		ENGINE_VERSION_STRING,
+		*SdkModuleName.ToLower(),
+		*SdkModuleVersion,
+		*PlatformName.ToLower());
+
+	// Referral analytics URL meta
+	if (IsReferralAnalyticsSet)
+	{
+		Meta->UrlQuery += FString::Printf(TEXT("&ref=%s&ref_v=%s"), *XRef.ToLower(), *XRefV.ToLower());
+	}
+
+	// Xsolla analytics header meta
+	Meta->Headers.Emplace(TEXT("X-ENGINE"), Engine.ToUpper());
+	Meta->Headers.Emplace(TEXT("X-ENGINE-V"), ENGINE_VERSION_STRING);
+	Meta->Headers.Emplace(TEXT("X-SDK"), SdkModuleName);
+	Meta->Headers.Emplace(TEXT("X-SDK-V"), SdkModuleVersion);
+	Meta->Headers.Emplace(TEXT("X-BUILD-PLATFORM"), PlatformName);
+
+	// Referral analytics header meta
+	if (IsReferralAnalyticsSet)
+	{
+		Meta->Headers.Emplace(TEXT("X-REF"), XRef);
+		Meta->Headers.Emplace(TEXT("X-REF-V"), XRefV);
+	}
+
+	RequestMetaCache.Add({SdkModuleName, SdkModuleVersion, Meta});
+	return Meta;
+}
+
+void XsollaUtilsHttpRequestHelper::ProcessRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest, const bool bAllowRecentResponse)
+{
+	XsollaUtilsHttpRequestBroker::Get().ProcessRequest(HttpRequest, bAllowRecentResponse);
+}
+
+void XsollaUtilsHttpRequestHelper::EnableResponseCache(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest)
+{
+	XsollaUtilsHttpCache::Get().PrepareRequest(HttpRequest);
+}
+
 bool XsollaUtilsHttpRequestHelper::ParseResponse(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded, XsollaHttpRequestError& OutError)
 {
 	if (bSucceeded && HttpResponse.IsValid())
@@ -153,14 +215,25 @@ bool XsollaUtilsHttpRequestHelper::ParseResponseAsJson(FHttpRequestPtr HttpReque
 {
 	if (bSucceeded && HttpResponse.IsValid())
 	{
-		FString ResponseStr = HttpResponse->GetContentAsString();
+		FString ResponseStr;
+		bool bIsOk = EHttpResponseCodes::IsOk(HttpResponse->GetResponseCode());
+
+		if (XsollaUtilsHttpCache::Get().TryGetNotModifiedContent(HttpRequest, HttpResponse, ResponseStr))
+		{
+			bIsOk = true;
+		}
+		else
+		{
+			ResponseStr = HttpResponse->GetContentAsString();
+			XsollaUtilsHttpCache::Get().StoreResponse(HttpRequest, HttpResponse, ResponseStr);
+		}
 
 		TSharedPtr<FJsonObject> JsonObject;
 		const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(*ResponseStr);
 
 		if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
 		{
-			if (EHttpResponseCodes::IsOk(HttpResponse->GetResponseCode()))
+			if (bIsOk)
 			{
 				OutResponse = JsonObject;
 				return true;
@@ -188,11 +261,44 @@ bool XsollaUtilsHttpRequestHelper::ParseResponseAsJson(FHttpRequestPtr HttpReque
 
 bool XsollaUtilsHttpRequestHelper::ParseResponseAsStruct(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded, const UStruct* OutResponseDefinition, void* OutResponse, XsollaHttpRequestError& OutError)
 {
+	return XsollaUtilsHttpRequestBroker::Get().ReadSharedStruct(HttpResponse, OutResponseDefinition, OutResponse, [&]()
+	{
+		return ParseUnsharedResponseAsStruct(HttpRequest, HttpResponse, bSucceeded, OutResponseDefinition, OutResponse, OutError);
+	});
+}
+
+bool XsollaUtilsHttpRequestHelper::ParseUnsharedResponseAsStruct(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded, const UStruct* OutResponseDefinition, void* OutResponse, XsollaHttpRequestError& OutError)
+{
+	if (bSucceeded && XsollaUtilsHttpCache::Get().TryGetNotModifiedStruct(HttpRequest, HttpResponse, OutResponseDefinition, OutResponse))
+	{
+		return true;
+	}
+
+	// Successful responses are decoded straight from the UTF-8 body, errors and cache hits go through the DOM
+	if (bSucceeded && HttpResponse.IsValid() && EHttpResponseCodes::IsOk(HttpResponse->GetResponseCode()))
+	{
+		if (XsollaUtilsJsonStructReader::ReadStruct(HttpResponse->GetContent(), OutResponseDefinition, OutResponse))
+		{
+			XsollaUtilsHttpCache::Get().StoreResponse(HttpRequest, HttpResponse);
+			XsollaUtilsHttpCache::Get().StoreStruct(HttpRequest, OutResponseDefinition, OutResponse);
+			return true;
+		}
+
+		UE_LOG(LogXsollaUtils, Verbose, TEXT("%s: Falling back to FJsonObjectConverter for %s"), *VA_FUNC_LINE, *OutResponseDefinition->GetName());
+
+		// Discard partially decoded values
+		if (const UScriptStruct* ScriptStruct = Cast<UScriptStruct>(OutResponseDefinition))
+		{
+			ScriptStruct->ClearScriptStruct(OutResponse);
+		}
+	}
+
 	TSharedPtr<FJsonObject> JsonObject;
 	if (ParseResponseAsJson(HttpRequest, HttpResponse, bSucceeded, JsonObject, OutError))
 	{
 		if (FJsonObjectConverter::JsonObjectToUStruct(JsonObject.ToSharedRef(), OutResponseDefinition, OutResponse))
 		{
+			XsollaUtilsHttpCache::Get().StoreStruct(HttpRequest, OutResponseDefinition, OutResponse);
 			return true;
 		}
 
@@ -0,0 +1,951 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#include "XsollaUtilsJsonStructReader.h"
+#include "Containers/StringConv.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/TextProperty.h"
+#include "UObject/UnrealType.h"
+
+namespace
+{
+	constexpr int32 MaxSkipDepth = 512;
+	constexpr int32 MaxNumberLength = 63;
+
+	bool IsJsonWhitespace(const uint8 Char)
+	{
+		return Char == ' ' || Char == '\t' || Char == '\n' || Char == '\r';
+	}
+
+	bool IsDigit(const uint8 Char)
+	{
+		return Char >= '0' && Char <= '9';
+	}
+
+	int32 HexToInt(const uint8 Char)
+	{
+		if (IsDigit(Char))
+		{
+			return Char - '0';
+		}
+		if (Char >= 'a' && Char <= 'f')
+		{
+			return Char - 'a' + 10;
+		}
+		if (Char >= 'A' && Char <= 'F')
+		{
+			return Char - 'A' + 10;
+		}
+		return -1;
+	}
+
+	bool ReadHex4(const uint8* Data, uint32& OutCodeUnit)
+	{
+		OutCodeUnit = 0;
+		for (int32 Index = 0; Index < 4; ++Index)
+		{
+			const int32 Digit = HexToInt(Data[Index]);
+			if (Digit < 0)
+			{
+				return false;
+			}
+			OutCodeUnit = (OutCodeUnit << 4) | Digit;
+		}
+		return true;
+	}
+
+	void AppendUtf8(FString& OutString, const uint8* Start, const uint8* Finish)
+	{
+		if (Finish > Start)
+		{
+			FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Start), UE_PTRDIFF_TO_INT32(Finish - Start));
+			OutString.AppendChars(Converted.Get(), Converted.Length());
+		}
+	}
+}
+
+TMap<const UStruct*, XsollaUtilsJsonStructReader::FStructDecoder> XsollaUtilsJsonStructReader::StructDecoders;
+
+XsollaUtilsJsonStructReader::XsollaUtilsJsonStructReader(const uint8* InData, const int32 InSize)
+	: Cur(InData)
+	, End(InData + InSize)
+	, SkipDepth(0)
+{
+	// Skip UTF-8 BOM
+	if (InSize >= 3 && InData[0] == 0xEF && InData[1] == 0xBB && InData[2] == 0xBF)
+	{
+		Cur += 3;
+	}
+}
+
+bool XsollaUtilsJsonStructReader::ReadStruct(const TArray<uint8>& Content, const UStruct* StructDefinition, void* OutStruct)
+{
+	XsollaUtilsJsonStructReader Reader(Content.GetData(), Content.Num());
+	return Reader.ReadStructValue(StructDefinition, OutStruct) && Reader.IsAtEnd();
+}
+
+void XsollaUtilsJsonStructReader::RegisterStructDecoder(const UScriptStruct* Struct, FStructDecoder Decoder)
+{
+	check(IsInGameThread());
+	StructDecoders.Add(Struct, Decoder);
+}
+
+void XsollaUtilsJsonStructReader::UnregisterStructDecoder(const UScriptStruct* Struct)
+{
+	check(IsInGameThread());
+	StructDecoders.Remove(Struct);
+}
+
+bool XsollaUtilsJsonStructReader::ReadStructValue(const UStruct* StructDefinition, void* OutStruct)
+{
+	if (const FStructDecoder* Decoder = StructDecoders.Find(StructDefinition))
+	{
+		return (*Decoder)(*this, OutStruct);
+	}
+
+	return ReadObjectFields([this, StructDefinition, OutStruct](FUtf8StringView FieldName)
+	{
+		return ReadStructField(StructDefinition, FieldName, OutStruct);
+	});
+}
+
+bool XsollaUtilsJsonStructReader::ReadObjectFields(TFunctionRef<bool(FUtf8StringView FieldName)> FieldReader)
+{
+	if (!Consume('{'))
+	{
+		return false;
+	}
+
+	if (Consume('}'))
+	{
+		return true;
+	}
+
+	do
+	{
+		if (!Consume('"'))
+		{
+			return false;
+		}
+
+		const uint8* NameStart = Cur;
+		while (Cur < End && *Cur != '"' && *Cur != '\\')
+		{
+			if (*Cur < 0x20)
+			{
+				return false;
+			}
+			++Cur;
+		}
+
+		if (Cur >= End)
+		{
+			return false;
+		}
+
+		bool bFieldRead = false;
+		if (*Cur == '"')
+		{
+			// Plain field name is passed as a view of the buffer
+			const FUtf8StringView FieldName(reinterpret_cast<const UTF8CHAR*>(NameStart), UE_PTRDIFF_TO_INT32(Cur - NameStart));
+			++Cur;
+
+			bFieldRead = Consume(':') && FieldReader(FieldName);
+		}
+		else
+		{
+			// Escaped field name, rare enough to decode it fully
+			Cur = NameStart - 1;
+
+			FString NameString;
+			if (!ReadString(NameString))
+			{
+				return false;
+			}
+
+			const FTCHARToUTF8 Converted(*NameString);
+			bFieldRead = Consume(':') && FieldReader(FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(Converted.Get()), Converted.Length()));
+		}
+
+		if (!bFieldRead)
+		{
+			return false;
+		}
+	} while (Consume(','));
+
+	return Consume('}');
+}
+
+bool XsollaUtilsJsonStructReader::ReadStructField(const UStruct* StructDefinition, FUtf8StringView FieldName, void* OutStruct)
+{
+	// Convert on the stack and look the name up without adding it to the name table
+	FName Name;
+	if (FieldName.Len() > 0 && FieldName.Len() < NAME_SIZE)
+	{
+		FUTF8ToTCHAR Converted(FieldName.GetData(), FieldName.Len());
+		Name = FName(Converted.Length(), Converted.Get(), FNAME_Find);
+	}
+
+	// FName comparison is case-insensitive, the same way FJsonObjectConverter matches field names
+	const FProperty* Property = Name.IsNone() ? nullptr : FindFProperty<FProperty>(StructDefinition, Name);
+	if (!Property)
+	{
+		return SkipValue();
+	}
+
+	// Static arrays are left to FJsonObjectConverter
+	if (Property->ArrayDim != 1)
+	{
+		return false;
+	}
+
+	return ConsumeNull() || ReadPropertyValue(Property, Property->ContainerPtrToValuePtr<void>(OutStruct));
+}
+
+bool XsollaUtilsJsonStructReader::ReadPropertyValue(const FProperty* Property, void* ValuePtr)
+{
+	if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+	{
+		return ReadEnumValue(EnumProperty->GetEnum(), EnumProperty->GetUnderlyingProperty(), ValuePtr);
+	}
+
+	if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+	{
+		if (const UEnum* Enum = NumericProperty->GetIntPropertyEnum())
+		{
+			return ReadEnumValue(Enum, NumericProperty, ValuePtr);
+		}
+		return ReadNumericValue(NumericProperty, ValuePtr);
+	}
+
+	if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+	{
+		bool bValue = false;
+		if (!ReadBoolValue(bValue))
+		{
+			return false;
+		}
+		BoolProperty->SetPropertyValue(ValuePtr, bValue);
+		return true;
+	}
+
+	if (CastField<FStrProperty>(Property))
+	{
+		return ReadStringValue(*static_cast<FString*>(ValuePtr));
+	}
+
+	if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+	{
+		FString Value;
+		if (!ReadStringValue(Value))
+		{
+			return false;
+		}
+		NameProperty->SetPropertyValue(ValuePtr, FName(*Value));
+		return true;
+	}
+
+	if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+	{
+		// Localized text objects are left to FJsonObjectConverter
+		FString Value;
+		if (PeekChar() != '"' || !ReadString(Value))
+		{
+			return false;
+		}
+		TextProperty->SetPropertyValue(ValuePtr, FText::FromString(Value));
+		return true;
+	}
+
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		const ANSICHAR Next = PeekChar();
+		if (Next == '{')
+		{
+			return ReadStructValue(StructProperty->Struct, ValuePtr);
+		}
+
+		if (Next == '"' && StructProperty->Struct == TBaseStructure<FDateTime>::Get())
+		{
+			return ReadValue(*static_cast<FDateTime*>(ValuePtr));
+		}
+
+		return false;
+	}
+
+	if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		if (!Consume('['))
+		{
+			return false;
+		}
+
+		FScriptArrayHelper Helper(ArrayProperty, ValuePtr);
+		Helper.EmptyValues();
+
+		if (Consume(']'))
+		{
+			return true;
+		}
+
+		do
+		{
+			// Null elements stay default initialized as FJsonObjectConverter leaves them
+			const int32 Index = Helper.AddValue();
+			if (!ConsumeNull() && !ReadPropertyValue(ArrayProperty->Inner, Helper.GetRawPtr(Index)))
+			{
+				return false;
+			}
+		} while (Consume(','));
+
+		return Consume(']');
+	}
+
+	if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+	{
+		if (!Consume('['))
+		{
+			return false;
+		}
+
+		FScriptSetHelper Helper(SetProperty, ValuePtr);
+		Helper.EmptyElements();
+
+		if (!Consume(']'))
+		{
+			do
+			{
+				if (ConsumeNull())
+				{
+					continue;
+				}
+
+				const int32 Index = Helper.AddDefaultValue_Invalid_NeedsRehash();
+				if (!ReadPropertyValue(SetProperty->ElementProp, Helper.GetElementPtr(Index)))
+				{
+					Helper.Rehash();
+					return false;
+				}
+			} while (Consume(','));
+
+			if (!Consume(']'))
+			{
+				Helper.Rehash();
+				return false;
+			}
+		}
+
+		Helper.Rehash();
+		return true;
+	}
+
+	if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		if (!Consume('{'))
+		{
+			return false;
+		}
+
+		FScriptMapHelper Helper(MapProperty, ValuePtr);
+		Helper.EmptyValues();
+
+		if (!Consume('}'))
+		{
+			FString Key;
+			do
+			{
+				if (!ReadString(Key) || !Consume(':'))
+				{
+					Helper.Rehash();
+					return false;
+				}
+
+				if (ConsumeNull())
+				{
+					continue;
+				}
+
+				const int32 Index = Helper.AddDefaultValue_Invalid_NeedsRehash();
+				MapProperty->KeyProp->ImportText_Direct(*Key, Helper.GetKeyPtr(Index), nullptr, PPF_None);
+				if (!ReadPropertyValue(MapProperty->ValueProp, Helper.GetValuePtr(Index)))
+				{
+					Helper.Rehash();
+					return false;
+				}
+			} while (Consume(','));
+
+			if (!Consume('}'))
+			{
+				Helper.Rehash();
+				return false;
+			}
+		}
+
+		Helper.Rehash();
+		return true;
+	}
+
+	// Object, delegate and other properties are left to FJsonObjectConverter
+	return false;
+}
+
+bool XsollaUtilsJsonStructReader::ReadValue(FString& OutValue)
+{
+	return ReadStringValue(OutValue);
+}
+
+bool XsollaUtilsJsonStructReader::ReadValue(bool& OutValue)
+{
+	return ReadBoolValue(OutValue);
+}
+
+bool XsollaUtilsJsonStructReader::ReadValue(int32& OutValue)
+{
+	FJsonNumber Number;
+	if (!ReadNumberValue(Number, false))
+	{
+		return false;
+	}
+	OutValue = static_cast<int32>(Number.Integer);
+	return true;
+}
+
+bool XsollaUtilsJsonStructReader::ReadValue(int64& OutValue)
+{
+	FJsonNumber Number;
+	if (!ReadNumberValue(Number, false))
+	{
+		return false;
+	}
+	OutValue = Number.Integer;
+	return true;
+}
+
+bool XsollaUtilsJsonStructReader::ReadValue(float& OutValue)
+{
+	FJsonNumber Number;
+	if (!ReadNumberValue(Number, true))
+	{
+		return false;
+	}
+	OutValue = static_cast<float>(Number.Double);
+	return true;
+}
+
+bool XsollaUtilsJsonStructReader::ReadValue(double& OutValue)
+{
+	FJsonNumber Number;
+	if (!ReadNumberValue(Number, true))
+	{
+		return false;
+	}
+	OutValue = Number.Double;
+	return true;
+}
+
+bool XsollaUtilsJsonStructReader::ReadValue(FDateTime& OutValue)
+{
+	FString Value;
+	if (PeekChar() != '"' || !ReadString(Value))
+	{
+		return false;
+	}
+
+	return FDateTime::ParseIso8601(*Value, OutValue) || FDateTime::Parse(Value, OutValue);
+}
+
+bool XsollaUtilsJsonStructReader::ReadString(FString& OutString)
+{
+	if (!Consume('"'))
+	{
+		return false;
+	}
+
+	OutString.Reset();
+
+	while (true)
+	{
+		const uint8* RunStart = Cur;
+		while (Cur < End && *Cur != '"' && *Cur != '\\')
+		{
+			if (*Cur < 0x20)
+			{
+				return false;
+			}
+			++Cur;
+		}
+
+		AppendUtf8(OutString, RunStart, Cur);
+
+		if (Cur >= End)
+		{
+			return false;
+		}
+
+		if (*Cur++ == '"')
+		{
+			return true;
+		}
+
+		if (!ReadEscape(OutString))
+		{
+			return false;
+		}
+	}
+}
+
+bool XsollaUtilsJsonStructReader::SkipValue()
+{
+	switch (PeekChar())
+	{
+	case '{':
+	case '[':
+	{
+		if (++SkipDepth > MaxSkipDepth)
+		{
+			return false;
+		}
+
+		const bool bObject = *Cur++ == '{';
+		const ANSICHAR Closing = bObject ? '}' : ']';
+		if (!Consume(Closing))
+		{
+			do
+			{
+				if (bObject && (!SkipString() || !Consume(':')))
+				{
+					return false;
+				}
+
+				if (!SkipValue())
+				{
+					return false;
+				}
+			} while (Consume(','));
+
+			if (!Consume(Closing))
+			{
+				return false;
+			}
+		}
+
+		--SkipDepth;
+		return true;
+	}
+
+	case '"':
+		return SkipString();
+
+	case 't':
+		return ConsumeLiteral("true", 4);
+
+	case 'f':
+		return ConsumeLiteral("false", 5);
+
+	case 'n':
+		return ConsumeLiteral("null", 4);
+
+	case 0:
+		return false;
+
+	default:
+	{
+		FJsonNumber Number;
+		return ReadNumber(Number);
+	}
+	}
+}
+
+bool XsollaUtilsJsonStructReader::ConsumeNull()
+{
+	return PeekChar() == 'n' && ConsumeLiteral("null", 4);
+}
+
+bool XsollaUtilsJsonStructReader::IsAtEnd()
+{
+	return !SkipWhitespace();
+}
+
+bool XsollaUtilsJsonStructReader::SkipWhitespace()
+{
+	while (Cur < End && IsJsonWhitespace(*Cur))
+	{
+		++Cur;
+	}
+	return Cur < End;
+}
+
+bool XsollaUtilsJsonStructReader::Consume(const ANSICHAR Char)
+{
+	if (SkipWhitespace() && *Cur == static_cast<uint8>(Char))
+	{
+		++Cur;
+		return true;
+	}
+	return false;
+}
+
+bool XsollaUtilsJsonStructReader::ConsumeLiteral(const ANSICHAR* Literal, const int32 Length)
+{
+	if (!SkipWhitespace() || End - Cur < Length || FMemory::Memcmp(Cur, Literal, Length) != 0)
+	{
+		return false;
+	}
+
+	Cur += Length;
+	return true;
+}
+
+ANSICHAR XsollaUtilsJsonStructReader::PeekChar()
+{
+	return SkipWhitespace() ? static_cast<ANSICHAR>(*Cur) : 0;
+}
+
+bool XsollaUtilsJsonStructReader::ReadEscape(FString& OutString)
+{
+	if (Cur >= End)
+	{
+		return false;
+	}
+
+	switch (*Cur++)
+	{
+	case '"':
+		OutString.AppendChar(TEXT('"'));
+		return true;
+	case '\\':
+		OutString.AppendChar(TEXT('\\'));
+		return true;
+	case '/':
+		OutString.AppendChar(TEXT('/'));
+		return true;
+	case 'b':
+		OutString.AppendChar(TEXT('\b'));
+		return true;
+	case 'f':
+		OutString.AppendChar(TEXT('\f'));
+		return true;
+	case 'n':
+		OutString.AppendChar(TEXT('\n'));
+		return true;
+	case 'r':
+		OutString.AppendChar(TEXT('\r'));
+		return true;
+	case 't':
+		OutString.AppendChar(TEXT('\t'));
+		return true;
+	case 'u':
+		break;
+	default:
+		return false;
+	}
+
+	uint32 CodeUnit = 0;
+	if (End - Cur < 4 || !ReadHex4(Cur, CodeUnit))
+	{
+		return false;
+	}
+	Cur += 4;
+
+	uint32 LowSurrogate = 0;
+	const bool bSurrogatePair = CodeUnit >= 0xD800 && CodeUnit <= 0xDBFF
+		&& End - Cur >= 6 && Cur[0] == '\\' && Cur[1] == 'u'
+		&& ReadHex4(Cur + 2, LowSurrogate) && LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF;
+
+	if (!bSurrogatePair)
+	{
+		OutString.AppendChar(static_cast<TCHAR>(CodeUnit));
+		return true;
+	}
+
+	Cur += 6;
+
+	if constexpr (sizeof(TCHAR) == 2)
+	{
+		OutString.AppendChar(static_cast<TCHAR>(CodeUnit));
+		OutString.AppendChar(static_cast<TCHAR>(LowSurrogate));
+	}
+	else
+	{
+		OutString.AppendChar(static_cast<TCHAR>(0x10000 + ((CodeUnit - 0xD800) << 10) + (LowSurrogate - 0xDC00)));
+	}
+
+	return true;
+}
+
+bool XsollaUtilsJsonStructReader::SkipString()
+{
+	if (!Consume('"'))
+	{
+		return false;
+	}
+
+	while (Cur < End)
+	{
+		const uint8 Char = *Cur++;
+		if (Char == '"')
+		{
+			return true;
+		}
+
+		if (Char == '\\')
+		{
+			if (Cur >= End)
+			{
+				return false;
+			}
+			++Cur;
+		}
+		else if (Char < 0x20)
+		{
+			return false;
+		}
+	}
+
+	return false;
+}
+
+bool XsollaUtilsJsonStructReader::ReadNumber(FJsonNumber& OutNumber)
+{
+	if (!SkipWhitespace())
+	{
+		return false;
+	}
+
+	// Validate against JSON number grammar
+	const uint8* NumberStart = Cur;
+	bool bInteger = true;
+
+	if (*Cur == '-')
+	{
+		++Cur;
+	}
+
+	const uint8* DigitsStart = Cur;
+	while (Cur < End && IsDigit(*Cur))
+	{
+		++Cur;
+	}
+	if (Cur == DigitsStart)
+	{
+		return false;
+	}
+
+	if (Cur < End && *Cur == '.')
+	{
+		bInteger = false;
+		const uint8* FractionStart = ++Cur;
+		while (Cur < End && IsDigit(*Cur))
+		{
+			++Cur;
+		}
+		if (Cur == FractionStart)
+		{
+			return false;
+		}
+	}
+
+	if (Cur < End && (*Cur == 'e' || *Cur == 'E'))
+	{
+		bInteger = false;
+		++Cur;
+		if (Cur < End && (*Cur == '+' || *Cur == '-'))
+		{
+			++Cur;
+		}
+		const uint8* ExponentStart = Cur;
+		while (Cur < End && IsDigit(*Cur))
+		{
+			++Cur;
+		}
+		if (Cur == ExponentStart)
+		{
+			return false;
+		}
+	}
+
+	const int32 NumberLength = UE_PTRDIFF_TO_INT32(Cur - NumberStart);
+	if (NumberLength > MaxNumberLength)
+	{
+		return false;
+	}
+
+	ANSICHAR Buffer[MaxNumberLength + 1];
+	FMemory::Memcpy(Buffer, NumberStart, NumberLength);
+	Buffer[NumberLength] = 0;
+
+	OutNumber.Double = FCStringAnsi::Atod(Buffer);
+	OutNumber.Integer = bInteger ? FCStringAnsi::Strtoi64(Buffer, nullptr, 10) : static_cast<int64>(FMath::RoundHalfFromZero(OutNumber.Double));
+	return true;
+}
+
+bool XsollaUtilsJsonStructReader::ReadNumberValue(FJsonNumber& OutNumber, const bool bFloatingPoint)
+{
+	switch (PeekChar())
+	{
+	case '"':
+	{
+		FString Value;
+		if (!ReadString(Value))
+		{
+			return false;
+		}
+
+		if (bFloatingPoint)
+		{
+			OutNumber.Double = Value.IsNumeric() ? FCString::Atod(*Value) : 0.0;
+		}
+		else
+		{
+			OutNumber.Integer = FCString::Atoi64(*Value);
+		}
+		return true;
+	}
+
+	case 't':
+	case 'f':
+	{
+		bool bValue = false;
+		if (!ReadBoolValue(bValue))
+		{
+			return false;
+		}
+
+		OutNumber.Double = bValue ? 1.0 : 0.0;
+		OutNumber.Integer = bValue ? 1 : 0;
+		return true;
+	}
+
+	case '{':
+	case '[':
+	case 'n':
+	case 0:
+		return false;
+
+	default:
+		return ReadNumber(OutNumber);
+	}
+}
+
+bool XsollaUtilsJsonStructReader::ReadNumericValue(const FNumericProperty* Property, void* ValuePtr)
+{
+	const bool bFloatingPoint = Property->IsFloatingPoint();
+
+	FJsonNumber Number;
+	if (!ReadNumberValue(Number, bFloatingPoint))
+	{
+		return false;
+	}
+
+	if (bFloatingPoint)
+	{
+		Property->SetFloatingPointPropertyValue(ValuePtr, Number.Double);
+	}
+	else
+	{
+		Property->SetIntPropertyValue(ValuePtr, Number.Integer);
+	}
+	return true;
+}
+
+bool XsollaUtilsJsonStructReader::ReadEnumValue(const UEnum* Enum, const FNumericProperty* UnderlyingProperty, void* ValuePtr)
+{
+	if (PeekChar() != '"')
+	{
+		return ReadNumericValue(UnderlyingProperty, ValuePtr);
+	}
+
+	FString Value;
+	if (!ReadString(Value))
+	{
+		return false;
+	}
+
+	const int64 EnumValue = Enum->GetValueByNameString(Value);
+	if (EnumValue == INDEX_NONE)
+	{
+		return false;
+	}
+
+	UnderlyingProperty->SetIntPropertyValue(ValuePtr, EnumValue);
+	return true;
+}
+
+bool XsollaUtilsJsonStructReader::ReadBoolValue(bool& OutValue)
+{
+	switch (PeekChar())
+	{
+	case 't':
+		OutValue = true;
+		return ConsumeLiteral("true", 4);
+
+	case 'f':
+		OutValue = false;
+		return ConsumeLiteral("false", 5);
+
+	case '"':
+	{
+		FString Value;
+		if (!ReadString(Value))
+		{
+			return false;
+		}
+		OutValue = Value.ToBool();
+		return true;
+	}
+
+	case '{':
+	case '[':
+	case 'n':
+	case 0:
+		return false;
+
+	default:
+	{
+		FJsonNumber Number;
+		if (!ReadNumber(Number))
+		{
+			return false;
+		}
+		OutValue = Number.Double != 0.0;
+		return true;
+	}
+	}
+}
+
+bool XsollaUtilsJsonStructReader::ReadStringValue(FString& OutString)
+{
+	switch (PeekChar())
+	{
+	case '"':
+		return ReadString(OutString);
+
+	case 't':
+	case 'f':
+	{
+		bool bValue = false;
+		if (!ReadBoolValue(bValue))
+		{
+			return false;
+		}
+		OutString = bValue ? TEXT("true") : TEXT("false");
+		return true;
+	}
+
+	case '{':
+	case '[':
+	case 'n':
+	case 0:
+		return false;
+
+	default:
+	{
+		FJsonNumber Number;
+		if (!ReadNumber(Number))
+		{
+			return false;
+		}
+		OutString = FString::SanitizeFloat(Number.Double, 0);
+		return true;
+	}
+	}
+}
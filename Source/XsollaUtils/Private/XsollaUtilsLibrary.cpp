@@ -124,6 +124,8 @@ void UXsollaUtilsLibrary::SetPartnerInfo(const FString& Referral, const FString&
 {
 	XReferral = Referral;
 	XReferralVersion = ReferralVersion;
+
+	XsollaUtilsHttpRequestHelper::InvalidateRequestMeta();
 }
 
 void UXsollaUtilsLibrary::GetPartnerInfo(FString& Referral, FString& ReferralVersion)
@@ -3,7 +3,11 @@
 #include "XsollaUtilsModule.h"
 
 #include "XsollaUtilsDefines.h"
+#include "XsollaUtilsHttpRequestBroker.h"
 #include "XsollaUtilsImageLoader.h"
+#include "XsollaUtilsSaveWriter.h"
+#include "XsollaProjectSettings.h"
+#include "XsollaSettingsModule.h"
 
 #define LOCTEXT_NAMESPACE "FXsollaUtilsModule"
 
@@ -14,10 +18,15 @@ void FXsollaUtilsModule::StartupModule()
 	// Initialize image loader
 	ImageLoader = NewObject<UXsollaUtilsImageLoader>();
 	ImageLoader->AddToRoot();
+
+	// Apply network settings shared by all Xsolla modules
+	XsollaUtilsHttpRequestBroker::Get().SetCoalescingWindow(FXsollaSettingsModule::Get().GetSettings()->RequestCoalescingWindow);
 }
 
 void FXsollaUtilsModule::ShutdownModule()
 {
+	XsollaUtilsSaveWriter::Get().Shutdown();
+
 	if (!GExitPurge)
 	{
 		// If we're in exit purge, this object has already been destroyed
@@ -0,0 +1,275 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#include "XsollaUtilsSaveWriter.h"
+#include "XsollaUtilsDefines.h"
+
+#include "Async/Async.h"
+#include "GameFramework/SaveGame.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeLock.h"
+
+XsollaUtilsSaveWriter::XsollaUtilsSaveWriter()
+	: CoalescingWindow(0.5f)
+	, LastVersion(0)
+{
+	// Scheduled saves would be lost if the app is killed in background or exits before they are written
+	EnterBackgroundHandle = FCoreDelegates::ApplicationWillEnterBackgroundDelegate.AddRaw(this, &XsollaUtilsSaveWriter::Flush);
+	PreExitHandle = FCoreDelegates::OnEnginePreExit.AddRaw(this, &XsollaUtilsSaveWriter::Flush);
+}
+
+XsollaUtilsSaveWriter& XsollaUtilsSaveWriter::Get()
+{
+	static XsollaUtilsSaveWriter Instance;
+	return Instance;
+}
+
+void XsollaUtilsSaveWriter::ScheduleSave(const FString& SlotName, const int32 UserIndex, TFunction<void()> PrepareData, TFunction<USaveGame*()> CreateSaveGame)
+{
+	check(IsInGameThread());
+
+	// Saves being written aren't replaced, a new one is scheduled after them
+	const TSharedRef<FSave> Save = MakeShared<FSave>();
+	Save->SlotName = SlotName;
+	Save->UserIndex = UserIndex;
+	Save->Version = ++LastVersion;
+	Save->PrepareData = MoveTemp(PrepareData);
+	Save->CreateSaveGame = MoveTemp(CreateSaveGame);
+	AddPendingSave(Save);
+}
+
+void XsollaUtilsSaveWriter::ScheduleDataSave(const FString& SlotName, const int32 UserIndex, TFunction<void(TArray<uint8>&)> SerializeData, const bool bWriteNow)
+{
+	check(IsInGameThread());
+
+	const TSharedRef<FSave> Save = MakeShared<FSave>();
+	Save->SlotName = SlotName;
+	Save->UserIndex = UserIndex;
+	Save->Version = ++LastVersion;
+	Save->SerializeData = MoveTemp(SerializeData);
+
+	if (!bWriteNow)
+	{
+		AddPendingSave(Save);
+		return;
+	}
+
+	// Pending save of the slot has older data, this one replaces it
+	PendingSaves.Remove(SlotName);
+	RemoveCompletedSaves();
+
+	ActiveSaves.Add(Save);
+	StartSave(Save);
+}
+
+void XsollaUtilsSaveWriter::AddPendingSave(const TSharedRef<FSave>& Save)
+{
+	PendingSaves.Add(Save->SlotName, Save);
+
+	if (!FlushTimerHandle.IsValid())
+	{
+		FlushTimerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &XsollaUtilsSaveWriter::OnFlushTimer), CoalescingWindow);
+	}
+}
+
+void XsollaUtilsSaveWriter::Flush()
+{
+	check(IsInGameThread());
+
+	if (FlushTimerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTimerHandle);
+		FlushTimerHandle.Reset();
+	}
+
+	for (const auto& Pair : PendingSaves)
+	{
+		ActiveSaves.Add(Pair.Value);
+	}
+	PendingSaves.Empty();
+
+	// Older saves are completed first, newer ones overwrite them
+	TArray<TSharedRef<FSave>> Saves = MoveTemp(ActiveSaves);
+	for (const TSharedRef<FSave>& Save : Saves)
+	{
+		CompleteSave(Save);
+	}
+}
+
+void XsollaUtilsSaveWriter::Shutdown()
+{
+	if (FlushTimerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTimerHandle);
+		FlushTimerHandle.Reset();
+	}
+
+	FCoreDelegates::ApplicationWillEnterBackgroundDelegate.Remove(EnterBackgroundHandle);
+	FCoreDelegates::OnEnginePreExit.Remove(PreExitHandle);
+
+	// Worker thread tasks reference the writer, so they are finished before the module is unloaded
+	for (const TSharedRef<FSave>& Save : ActiveSaves)
+	{
+		if (Save->PrepareTask.IsValid())
+		{
+			Save->PrepareTask.Wait();
+		}
+
+		if (Save->WriteTask.IsValid())
+		{
+			Save->WriteTask.Wait();
+		}
+	}
+
+	ActiveSaves.Empty();
+	PendingSaves.Empty();
+}
+
+bool XsollaUtilsSaveWriter::OnFlushTimer(float DeltaTime)
+{
+	FlushTimerHandle.Reset();
+
+	RemoveCompletedSaves();
+
+	for (const auto& Pair : PendingSaves)
+	{
+		ActiveSaves.Add(Pair.Value);
+		StartSave(Pair.Value);
+	}
+
+	PendingSaves.Empty();
+
+	// One-shot timer, it's added again by the next scheduled save
+	return false;
+}
+
+void XsollaUtilsSaveWriter::RemoveCompletedSaves()
+{
+	// Completed saves are removed when new ones start, so the list doesn't grow between flushes
+	ActiveSaves.RemoveAll([](const TSharedRef<FSave>& Save)
+	{
+		return Save->bIsSerialized && (!Save->WriteTask.IsValid() || Save->WriteTask.IsReady());
+	});
+}
+
+void XsollaUtilsSaveWriter::StartSave(const TSharedRef<FSave>& Save)
+{
+	if (Save->SerializeData)
+	{
+		Save->bIsSerialized = true;
+		Save->WriteTask = Async(EAsyncExecution::ThreadPool, [this, Save]()
+		{
+			TArray<uint8> Data;
+			if (SerializeSave(*Save, Data))
+			{
+				WriteData(*Save, Data);
+			}
+		});
+		return;
+	}
+
+	if (!Save->PrepareData)
+	{
+		SerializeAndWriteAsync(Save);
+		return;
+	}
+
+	Save->PrepareTask = Async(EAsyncExecution::ThreadPool, [this, Save]()
+	{
+		Save->PrepareData();
+
+		AsyncTask(ENamedThreads::GameThread, [this, Save]()
+		{
+			SerializeAndWriteAsync(Save);
+		});
+	});
+}
+
+void XsollaUtilsSaveWriter::SerializeAndWriteAsync(const TSharedRef<FSave>& Save)
+{
+	if (Save->bIsSerialized)
+	{
+		// Already written by Flush
+		return;
+	}
+
+	Save->bIsSerialized = true;
+
+	TArray<uint8> Data;
+	if (!SerializeSave(*Save, Data))
+	{
+		return;
+	}
+
+	Save->WriteTask = Async(EAsyncExecution::ThreadPool, [this, Save, Data = MoveTemp(Data)]()
+	{
+		WriteData(*Save, Data);
+	});
+}
+
+void XsollaUtilsSaveWriter::CompleteSave(const TSharedRef<FSave>& Save)
+{
+	if (Save->bIsSerialized)
+	{
+		if (Save->WriteTask.IsValid())
+		{
+			Save->WriteTask.Wait();
+		}
+		return;
+	}
+
+	if (Save->PrepareTask.IsValid())
+	{
+		// Preparation doesn't depend on the game thread, so it's safe to wait for it
+		Save->PrepareTask.Wait();
+	}
+	else if (Save->PrepareData)
+	{
+		Save->PrepareData();
+	}
+
+	Save->bIsSerialized = true;
+
+	TArray<uint8> Data;
+	if (SerializeSave(*Save, Data))
+	{
+		WriteData(*Save, Data);
+	}
+}
+
+bool XsollaUtilsSaveWriter::SerializeSave(const FSave& Save, TArray<uint8>& OutData)
+{
+	if (Save.SerializeData)
+	{
+		Save.SerializeData(OutData);
+		return true;
+	}
+
+	USaveGame* SaveGame = Save.CreateSaveGame();
+	if (!SaveGame || !UGameplayStatics::SaveGameToMemory(SaveGame, OutData))
+	{
+		UE_LOG(LogXsollaUtils, Error, TEXT("%s: Can't serialize save game"), *VA_FUNC_LINE);
+		return false;
+	}
+
+	return true;
+}
+
+void XsollaUtilsSaveWriter::WriteData(const FSave& Save, const TArray<uint8>& Data)
+{
+	FScopeLock Lock(&WriteLock);
+
+	uint64& WrittenVersion = WrittenVersions.FindOrAdd(Save.SlotName);
+	if (Save.Version <= WrittenVersion)
+	{
+		// Newer data is already written
+		return;
+	}
+
+	if (!UGameplayStatics::SaveDataToSlot(Data, Save.SlotName, Save.UserIndex))
+	{
+		UE_LOG(LogXsollaUtils, Error, TEXT("%s: Can't write save slot %s"), *VA_FUNC_LINE, *Save.SlotName);
+	}
+
+	WrittenVersion = Save.Version;
+}
@@ -5,9 +5,13 @@
 
 #include "Dom/JsonObject.h"
 #include "Misc/Base64.h"
+#include "Misc/ScopeLock.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 
+TArray<UXsollaUtilsTokenParser::FTokenCacheEntry> UXsollaUtilsTokenParser::TokenCache;
+FCriticalSection UXsollaUtilsTokenParser::TokenCacheLock;
+
 UXsollaUtilsTokenParser::UXsollaUtilsTokenParser(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -46,10 +50,58 @@ bool UXsollaUtilsTokenParser::ParseTokenPayload(const FString& Token, TSharedPtr
 	return true;
 }
 
-bool UXsollaUtilsTokenParser::GetStringTokenParam(const FString& Token, const FString& ParamName, FString& ParamValue)
+void UXsollaUtilsTokenParser::ClearTokenCache()
 {
+	FScopeLock Lock(&TokenCacheLock);
+	TokenCache.Empty();
+}
+
+TSharedPtr<const FJsonObject> UXsollaUtilsTokenParser::GetTokenPayload(const FString& Token)
+{
+	// Tokens are case-sensitive, while FString hash and comparison ignore case
+	const uint32 TokenHash = FCrc::StrCrc32(*Token);
+
+	FScopeLock Lock(&TokenCacheLock);
+
+	for (int32 Index = 0; Index < TokenCache.Num(); ++Index)
+	{
+		if (TokenCache[Index].TokenHash == TokenHash && TokenCache[Index].Token.Equals(Token, ESearchCase::CaseSensitive))
+		{
+			if (Index > 0)
+			{
+				FTokenCacheEntry Entry = MoveTemp(TokenCache[Index]);
+				TokenCache.RemoveAt(Index);
+				TokenCache.Insert(MoveTemp(Entry), 0);
+			}
+			return TokenCache[0].Payload;
+		}
+	}
+
 	TSharedPtr<FJsonObject> PayloadJsonObject;
 	if (!ParseTokenPayload(Token, PayloadJsonObject))
+	{
+		return nullptr;
+	}
+
+	// Tokens are replaced on refresh, so the least recently used one is evicted
+	if (TokenCache.Num() >= TokenCacheCapacity)
+	{
+		TokenCache.Pop();
+	}
+
+	FTokenCacheEntry Entry;
+	Entry.TokenHash = TokenHash;
+	Entry.Token = Token;
+	Entry.Payload = PayloadJsonObject;
+	TokenCache.Insert(MoveTemp(Entry), 0);
+
+	return PayloadJsonObject;
+}
+
+bool UXsollaUtilsTokenParser::GetStringTokenParam(const FString& Token, const FString& ParamName, FString& ParamValue)
+{
+	const TSharedPtr<const FJsonObject> PayloadJsonObject = GetTokenPayload(Token);
+	if (!PayloadJsonObject.IsValid())
 	{
 		UE_LOG(LogXsollaUtils, Error, TEXT("%s: Can't parse token payload"), *VA_FUNC_LINE);
 		return false;
@@ -67,8 +119,8 @@ bool UXsollaUtilsTokenParser::GetStringTokenParam(const FString& Token, const FS
 bool UXsollaUtilsTokenParser::GetBoolTokenParam(const FString& Token, const FString& ParamName, bool& ParamValue)
 {
 	ParamValue = false;
-	TSharedPtr<FJsonObject> PayloadJsonObject;
-	if (!ParseTokenPayload(Token, PayloadJsonObject))
+	const TSharedPtr<const FJsonObject> PayloadJsonObject = GetTokenPayload(Token);
+	if (!PayloadJsonObject.IsValid())
 	{
 		UE_LOG(LogXsollaUtils, Error, TEXT("%s: Can't parse token payload"), *VA_FUNC_LINE);
 		return false;
@@ -86,8 +138,8 @@ bool UXsollaUtilsTokenParser::GetBoolTokenParam(const FString& Token, const FStr
 bool UXsollaUtilsTokenParser::GetInt64TokenParam(const FString& Token, const FString& ParamName, int64& ParamValue)
 {
 	ParamValue = 0;
-	TSharedPtr<FJsonObject> PayloadJsonObject;
-	if (!ParseTokenPayload(Token, PayloadJsonObject))
+	const TSharedPtr<const FJsonObject> PayloadJsonObject = GetTokenPayload(Token);
+	if (!PayloadJsonObject.IsValid())
 	{
 		UE_LOG(LogXsollaUtils, Error, TEXT("%s: Can't parse token payload"), *VA_FUNC_LINE);
 		return false;
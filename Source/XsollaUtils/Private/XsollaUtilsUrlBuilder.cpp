@@ -2,36 +2,226 @@
 
 #include "XsollaUtilsUrlBuilder.h"
 
+namespace
+{
+	bool IsUnreservedChar(const uint8 Char, const bool bQueryValue)
+	{
+		// Commas are kept in query values as they separate values of params sent as one
+		return (Char >= 'A' && Char <= 'Z') || (Char >= 'a' && Char <= 'z') || (Char >= '0' && Char <= '9')
+			|| Char == '-' || Char == '_' || Char == '.' || Char == '~'
+			|| (bQueryValue && Char == ',');
+	}
+
+	/** Calls Visitor for each byte of UTF-8 representation of the string without converting it. */
+	template <typename VisitorType>
+	void VisitUtf8Bytes(const FString& Value, VisitorType&& Visitor)
+	{
+		const TCHAR* Chars = *Value;
+		const int32 Length = Value.Len();
+		for (int32 Index = 0; Index < Length; ++Index)
+		{
+			uint32 CodePoint = static_cast<uint32>(Chars[Index]);
+			if (CodePoint < 0x80)
+			{
+				Visitor(static_cast<uint8>(CodePoint));
+				continue;
+			}
+
+			// Combine UTF-16 surrogate pair
+			if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && Index + 1 < Length)
+			{
+				const uint32 LowSurrogate = static_cast<uint32>(Chars[Index + 1]);
+				if (LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+				{
+					CodePoint = ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00) + 0x10000;
+					++Index;
+				}
+			}
+
+			if (CodePoint < 0x800)
+			{
+				Visitor(static_cast<uint8>(0xC0 | (CodePoint >> 6)));
+			}
+			else if (CodePoint < 0x10000)
+			{
+				Visitor(static_cast<uint8>(0xE0 | (CodePoint >> 12)));
+				Visitor(static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F)));
+			}
+			else
+			{
+				Visitor(static_cast<uint8>(0xF0 | (CodePoint >> 18)));
+				Visitor(static_cast<uint8>(0x80 | ((CodePoint >> 12) & 0x3F)));
+				Visitor(static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F)));
+			}
+			Visitor(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+		}
+	}
+
+	int32 GetEncodedLength(const FString& Value, const bool bQueryValue)
+	{
+		int32 EncodedLength = 0;
+		VisitUtf8Bytes(Value, [&EncodedLength, bQueryValue](const uint8 Byte)
+		{
+			EncodedLength += IsUnreservedChar(Byte, bQueryValue) ? 1 : 3;
+		});
+		return EncodedLength;
+	}
+
+	void AppendEncoded(FString& OutUrl, const FString& Value, const bool bQueryValue)
+	{
+		static const TCHAR HexDigits[] = TEXT("0123456789ABCDEF");
+
+		VisitUtf8Bytes(Value, [&OutUrl, bQueryValue](const uint8 Byte)
+		{
+			if (IsUnreservedChar(Byte, bQueryValue))
+			{
+				OutUrl.AppendChar(static_cast<TCHAR>(Byte));
+			}
+			else
+			{
+				OutUrl.AppendChar(TEXT('%'));
+				OutUrl.AppendChar(HexDigits[Byte >> 4]);
+				OutUrl.AppendChar(HexDigits[Byte & 0x0F]);
+			}
+		});
+	}
+
+	/** Upper bound of int32 length in decimal. */
+	constexpr int32 MaxNumberLength = 11;
+}
+
+XsollaUtilsUrlTemplate::XsollaUtilsUrlTemplate(const FString& UrlTemplate)
+	: LiteralLength(0)
+	, bHasQuery(false)
+{
+	const int32 Length = UrlTemplate.Len();
+	int32 LiteralStart = 0;
+	int32 Index = 0;
+
+	while (Index < Length)
+	{
+		const TCHAR Char = UrlTemplate[Index];
+		if (Char == TEXT('{'))
+		{
+			const int32 CloseIndex = UrlTemplate.Find(TEXT("}"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index + 1);
+			if (CloseIndex != INDEX_NONE)
+			{
+				if (Index > LiteralStart)
+				{
+					Segments.Add({UrlTemplate.Mid(LiteralStart, Index - LiteralStart), false});
+					LiteralLength += Index - LiteralStart;
+				}
+
+				Segments.Add({UrlTemplate.Mid(Index + 1, CloseIndex - Index - 1), true});
+
+				Index = CloseIndex + 1;
+				LiteralStart = Index;
+				continue;
+			}
+		}
+		else if (Char == TEXT('?'))
+		{
+			bHasQuery = true;
+		}
+
+		++Index;
+	}
+
+	if (Length > LiteralStart)
+	{
+		Segments.Add({UrlTemplate.Mid(LiteralStart), false});
+		LiteralLength += Length - LiteralStart;
+	}
+}
+
 XsollaUtilsUrlBuilder::XsollaUtilsUrlBuilder(const FString& UrlTemplate)
-	: Url(UrlTemplate)
+	: OwnedTemplate(XsollaUtilsUrlTemplate(UrlTemplate))
+	, SharedTemplate(nullptr)
+{
+}
+
+XsollaUtilsUrlBuilder::XsollaUtilsUrlBuilder(const XsollaUtilsUrlTemplate& UrlTemplate)
+	: SharedTemplate(&UrlTemplate)
 {
 }
 
 FString XsollaUtilsUrlBuilder::Build()
 {
-	FString ResultUrl = Url;
+	const XsollaUtilsUrlTemplate& UrlTemplate = GetTemplate();
+
+	// Resolve path params first, so the whole length is known before writing
+	TArray<const FString*, TInlineAllocator<8>> PathValues;
+	int32 ResultLength = UrlTemplate.LiteralLength;
+
+	for (const auto& Segment : UrlTemplate.Segments)
+	{
+		if (!Segment.bIsPlaceholder)
+		{
+			continue;
+		}
+
+		const auto* Param = PathParams.FindByPredicate([&Segment](const TPair<FString, FString>& PathParam)
+		{
+			return PathParam.Key.Equals(Segment.Text, ESearchCase::IgnoreCase);
+		});
+
+		// Placeholders without params are kept as is
+		PathValues.Add(Param ? &Param->Value : nullptr);
+		ResultLength += Param ? GetEncodedLength(Param->Value, false) : Segment.Text.Len() + 2;
+	}
+
+	for (const auto& Param : StringQueryParams)
+	{
+		ResultLength += GetEncodedLength(Param.Key, true) + GetEncodedLength(Param.Value, true) + 2;
+	}
+
+	for (const auto& Param : NumberQueryParams)
+	{
+		ResultLength += GetEncodedLength(Param.Key, true) + MaxNumberLength + 2;
+	}
+
+	FString ResultUrl;
+	ResultUrl.Reserve(ResultLength);
 
 	// set path params
-	for (const auto& Param : PathParams)
+	int32 PathValueIndex = 0;
+	for (const auto& Segment : UrlTemplate.Segments)
 	{
-		const FString ParamPlaceholder = FString::Printf(TEXT("{%s}"), *Param.Key);
-		if (ResultUrl.Contains(ParamPlaceholder))
+		if (!Segment.bIsPlaceholder)
 		{
-			ResultUrl = ResultUrl.Replace(*ParamPlaceholder, *Param.Value);
+			ResultUrl.Append(Segment.Text);
+		}
+		else if (const FString* PathValue = PathValues[PathValueIndex++])
+		{
+			AppendEncoded(ResultUrl, *PathValue, false);
+		}
+		else
+		{
+			ResultUrl.AppendChar(TEXT('{'));
+			ResultUrl.Append(Segment.Text);
+			ResultUrl.AppendChar(TEXT('}'));
 		}
 	}
 
 	// add query params
+	TCHAR Separator = UrlTemplate.bHasQuery ? TEXT('&') : TEXT('?');
+
 	for (const auto& Param : StringQueryParams)
 	{
-		const FString NewParam = FString::Printf(TEXT("%s%s=%s"), ResultUrl.Contains(TEXT("?")) ? TEXT("&") : TEXT("?"), *Param.Key, *Param.Value);
-		ResultUrl.Append(NewParam);
+		ResultUrl.AppendChar(Separator);
+		AppendEncoded(ResultUrl, Param.Key, true);
+		ResultUrl.AppendChar(TEXT('='));
+		AppendEncoded(ResultUrl, Param.Value, true);
+		Separator = TEXT('&');
 	}
 
 	for (const auto& Param : NumberQueryParams)
 	{
-		const FString NewParam = FString::Printf(TEXT("%s%s=%d"), ResultUrl.Contains(TEXT("?")) ? TEXT("&") : TEXT("?"), *Param.Key, Param.Value);
-		ResultUrl.Append(NewParam);
+		ResultUrl.AppendChar(Separator);
+		AppendEncoded(ResultUrl, Param.Key, true);
+		ResultUrl.AppendChar(TEXT('='));
+		ResultUrl.AppendInt(Param.Value);
+		Separator = TEXT('&');
 	}
 
 	return ResultUrl;
@@ -124,4 +314,9 @@ XsollaUtilsUrlBuilder& XsollaUtilsUrlBuilder::AddBoolQueryParam(const FString& P
 	}
 
 	return *this;
+}
+
+const XsollaUtilsUrlTemplate& XsollaUtilsUrlBuilder::GetTemplate() const
+{
+	return SharedTemplate ? *SharedTemplate : OwnedTemplate.GetValue();
 }
\ No newline at end of file
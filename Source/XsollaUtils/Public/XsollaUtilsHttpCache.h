@@ -0,0 +1,103 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Http.h"
+#include "UObject/StructOnScope.h"
+
+/**
+ * Persistent cache for GET responses validated with ETag/Last-Modified.
+ *
+ * Requests opt in with XsollaUtilsHttpRequestHelper::EnableResponseCache. Cached entries are keyed by
+ * the request URL (which includes project, locale, country and additional fields) and the user the
+ * Authorization header belongs to. `304 Not Modified` responses are resolved by the parse methods of
+ * XsollaUtilsHttpRequestHelper, so request handlers don't need to know about the cache.
+ */
+class XSOLLAUTILS_API XsollaUtilsHttpCache
+{
+public:
+	static XsollaUtilsHttpCache& Get();
+
+	/** Enables or disables the cache. Disabled cache doesn't modify requests and doesn't store responses. */
+	void SetEnabled(const bool bInEnabled);
+	bool IsEnabled() const;
+
+	/** Marks the request as cacheable and adds conditional headers if a validated entry is available. Must be called after the URL and headers are set. */
+	void PrepareRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest);
+
+	/** Returns the cached response body if the server replied `304 Not Modified` to a cacheable request. */
+	bool TryGetNotModifiedContent(const FHttpRequestPtr& HttpRequest, const FHttpResponsePtr& HttpResponse, FString& OutContent);
+
+	/**
+	 * Returns true if the server replied `304 Not Modified` to a conditional request, but the cached body is gone
+	 * (e.g. the cache was cleared meanwhile). The request is registered again, so the response to the request
+	 * repeated without validators is stored.
+	 */
+	bool NeedsUnconditionalRetry(const FHttpRequestPtr& HttpRequest, const FHttpResponsePtr& HttpResponse);
+
+	/** Copies the already converted struct if the server replied `304 Not Modified` to a cacheable request. */
+	bool TryGetNotModifiedStruct(const FHttpRequestPtr& HttpRequest, const FHttpResponsePtr& HttpResponse, const UStruct* StructDefinition, void* OutStruct);
+
+	/** Stores a successful response body together with its validators. Does nothing for requests that didn't opt in. */
+	void StoreResponse(const FHttpRequestPtr& HttpRequest, const FHttpResponsePtr& HttpResponse, const FString& Content);
+
+	/** Stores the raw response body without converting it to string. The response is kept in memory until its body is written to disk. */
+	void StoreResponse(const FHttpRequestPtr& HttpRequest, const FHttpResponsePtr& HttpResponse);
+
+	/** Keeps a converted copy of the cached response so the next `304 Not Modified` skips JSON conversion. */
+	void StoreStruct(const FHttpRequestPtr& HttpRequest, const UStruct* StructDefinition, const void* Struct);
+
+	/** Removes all cached entries from memory and disk. Writes that haven't started yet are dropped. */
+	void Clear();
+
+private:
+	XsollaUtilsHttpCache();
+
+	struct FCacheEntry
+	{
+		FString ETag;
+		FString LastModified;
+		FString Content;
+		bool bContentLoaded = false;
+
+		/** Response whose body is being written to disk. Its content is used until the write is done. */
+		FHttpResponsePtr PendingResponse;
+
+		/** Identifies the last write of the entry, so that an older write doesn't release a newer response. */
+		uint64 WriteId = 0;
+
+		TSharedPtr<FStructOnScope> ConvertedStruct;
+	};
+
+	FString GetCacheKey(const FHttpRequestPtr& HttpRequest) const;
+	FString GetCacheDir() const;
+	FString GetContentPath(const FString& Key) const;
+	FString GetMetaPath(const FString& Key) const;
+
+	/** Finds entry in memory or loads its validators from disk. */
+	FCacheEntry* FindOrLoadEntry(const FString& Key);
+	bool IsNotModified(const FHttpRequestPtr& HttpRequest, const FHttpResponsePtr& HttpResponse, FString& OutKey) const;
+
+	/** Updates validators of the entry from the response. Returns null if the body doesn't need to be written. */
+	FCacheEntry* UpdateEntry(const FHttpRequestPtr& HttpRequest, const FHttpResponsePtr& HttpResponse, FString& OutKey);
+	void RemoveEntry(const FString& Key);
+
+	/** Writes the body with WriteContent and then the validators of the entry on a worker thread. */
+	void WriteEntryAsync(const FString& Key, FCacheEntry& Entry, TFunction<bool(const FString& ContentPath)> WriteContent);
+
+	bool bEnabled;
+
+	/** Entries of requests that opted in. Entry without validators means the response is not cached yet. */
+	TMap<FString, FCacheEntry> Entries;
+
+	mutable FCriticalSection EntriesLock;
+
+	uint64 LastWriteId;
+
+	/** Incremented by Clear(). Writes scheduled before that are dropped, so they don't bring removed files back. */
+	uint32 ClearGeneration;
+
+	/** Guards file writes against Clear(). Never taken together with EntriesLock by writers. */
+	FCriticalSection WriteLock;
+};
@@ -0,0 +1,81 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Http.h"
+#include "UObject/StructOnScope.h"
+
+/**
+ * Coalesces identical GET requests (same URL, Authorization and cache validator headers).
+ *
+ * While a request is in flight, identical requests aren't sent and get its response instead. With a coalescing
+ * window set, successful responses are also reused for identical requests started shortly after completion.
+ * A shared response is decoded once, see ReadSharedStruct. Requests with other verbs are sent as is.
+ * Used by XsollaUtilsHttpRequestHelper::ProcessRequest.
+ */
+class XSOLLAUTILS_API XsollaUtilsHttpRequestBroker
+{
+public:
+	static XsollaUtilsHttpRequestBroker& Get();
+
+	/** Sets how long (in seconds) a successful GET response is reused for identical requests. Zero only coalesces requests in flight. */
+	void SetCoalescingWindow(const float InSeconds);
+	float GetCoalescingWindow() const;
+
+	/**
+	 * Sends the request or attaches it to an identical one. Completion delegate is always called, asynchronously.
+	 * Requests that poll for changes (e.g. order status) should disallow recent responses, they still share a request in flight.
+	 */
+	void ProcessRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest, const bool bAllowRecentResponse = true);
+
+	/**
+	 * Reads the response into the struct with ReadStruct once for all requests sharing the response and copies the result for the rest.
+	 * Responses that aren't shared are read as is. Thread-safe.
+	 */
+	bool ReadSharedStruct(const FHttpResponsePtr& HttpResponse, const UStruct* StructDefinition, void* OutStruct, TFunctionRef<bool()> ReadStruct);
+
+private:
+	XsollaUtilsHttpRequestBroker();
+
+	struct FCompletedRequest
+	{
+		FHttpResponsePtr HttpResponse;
+		double CompletionTime = 0.0;
+	};
+
+	/** Struct decoded from a response delivered to several requests. */
+	struct FSharedResponse
+	{
+		TWeakPtr<IHttpResponse, ESPMode::ThreadSafe> HttpResponse;
+
+		/** Held while the struct is decoded, so other requests wait for it instead of decoding the same body. */
+		FCriticalSection Lock;
+
+		TSharedPtr<FStructOnScope> DecodedStruct;
+	};
+
+	FString GetRequestKey(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest) const;
+
+	void OnRequestComplete(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded,
+		FString RequestKey, FHttpRequestCompleteDelegate OriginalDelegate);
+
+	/** Copies the request without `If-None-Match` and `If-Modified-Since` headers. */
+	static TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateUnconditionalRequest(const FHttpRequestPtr& HttpRequest);
+
+	/** Removes completed responses that are outside the coalescing window. */
+	void RemoveExpiredResponses(const double Now);
+
+	/** Marks the response as delivered to several requests. */
+	void AddSharedResponse(const FHttpResponsePtr& HttpResponse);
+
+	float CoalescingWindow;
+
+	/** Requests waiting for the in-flight request with the same key. */
+	TMap<FString, TArray<TSharedRef<IHttpRequest, ESPMode::ThreadSafe>>> InFlightRequests;
+
+	TMap<FString, FCompletedRequest> CompletedRequests;
+
+	TMap<const IHttpResponse*, TSharedRef<FSharedResponse, ESPMode::ThreadSafe>> SharedResponses;
+	FCriticalSection SharedResponsesLock;
+};
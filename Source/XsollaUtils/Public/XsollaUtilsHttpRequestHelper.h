@@ -3,8 +3,10 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Async/Async.h"
 #include "Http.h"
 #include "JsonObjectConverter.h"
+#include "UObject/WeakObjectPtrTemplates.h"
 
 class FJsonObject;
 
@@ -55,22 +57,98 @@ public:
 
 	static FString GetVerbAsString(const EXsollaHttpRequestVerb Verb);
 
+	/** Drops precomputed analytics meta, so the next requests pick up changed partner info. */
+	static void InvalidateRequestMeta();
+
+	/**
+	 * Sends the request. Identical GET requests in flight share one response, see XsollaUtilsHttpRequestBroker.
+	 * Requests that poll for changes should disallow responses reused from the coalescing window.
+	 */
+	static void ProcessRequest(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest, const bool bAllowRecentResponse = true);
+
+	/** Makes the GET request conditional (ETag/Last-Modified) and caches its response on disk. `304 Not Modified` is resolved by the parse methods. */
+	static void EnableResponseCache(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest);
+
 	static bool ParseResponse(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded, XsollaHttpRequestError& OutError);
 	static bool ParseResponseAsJson(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded, TSharedPtr<FJsonObject>& OutResponse, XsollaHttpRequestError& OutError);
 	static bool ParseResponseAsStruct(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded, const UStruct* OutResponseDefinition, void* OutResponse, XsollaHttpRequestError& OutError);
 
+	/**
+	 * Parses response into the struct on a worker thread, then calls one of the callbacks on the game thread.
+	 * Callbacks are skipped if the owner is destroyed in the meantime.
+	 */
+	template <typename OutStructType>
+	static void ParseResponseAsStructAsync(const UObject* Owner, FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded,
+		TFunction<void(const OutStructType&)> SuccessCallback, TFunction<void(const XsollaHttpRequestError&)> ErrorCallback);
+
 	template <typename OutStructType>
 	static bool ParseResponseAsArray(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded, TArray<OutStructType>* OutResponse, XsollaHttpRequestError& OutError);
 
 	static bool ParseError(TSharedPtr<FJsonObject> JsonObject, XsollaHttpRequestError& OutError);
 
 private:
+	/** Parses response into the struct, ParseResponseAsStruct shares the result between requests with the same response. */
+	static bool ParseUnsharedResponseAsStruct(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded, const UStruct* OutResponseDefinition, void* OutResponse, XsollaHttpRequestError& OutError);
+
+	/** Analytics URL meta and headers that are the same for all requests of the SDK module. */
+	struct FRequestMeta
+	{
+		/** Query parameters without the leading separator. */
+		FString UrlQuery;
+
+		TArray<TPair<FString, FString>> Headers;
+	};
+
+	struct FRequestMetaEntry
+	{
+		FString SdkModuleName;
+		FString SdkModuleVersion;
+		TSharedRef<const FRequestMeta, ESPMode::ThreadSafe> Meta;
+	};
+
+	static TSharedRef<const FRequestMeta, ESPMode::ThreadSafe> GetRequestMeta(const FString& SdkModuleName, const FString& SdkModuleVersion);
+
+	/** Precomputed meta by module name and version. There are only a few SDK modules, so entries are matched in place without building a key. */
+	static TArray<FRequestMetaEntry> RequestMetaCache;
+	static FCriticalSection RequestMetaCacheLock;
+
 	static const FString NoResponseErrorMsg;
 	static const FString UnknownErrorMsg;
 	static const FString DeserializationErrorMsg;
 	static const FString ConversionErrorMsg;
 };
 
+template <typename OutStructType>
+void XsollaUtilsHttpRequestHelper::ParseResponseAsStructAsync(const UObject* Owner, FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded,
+	TFunction<void(const OutStructType&)> SuccessCallback, TFunction<void(const XsollaHttpRequestError&)> ErrorCallback)
+{
+	if (!FPlatformProcess::SupportsMultithreading())
+	{
+		OutStructType Response;
+		XsollaHttpRequestError OutError;
+		ParseResponseAsStruct(HttpRequest, HttpResponse, bSucceeded, OutStructType::StaticStruct(), &Response, OutError) ? SuccessCallback(Response) : ErrorCallback(OutError);
+		return;
+	}
+
+	TWeakObjectPtr<const UObject> WeakOwner(Owner);
+	Async(EAsyncExecution::TaskGraph, [WeakOwner, HttpRequest, HttpResponse, bSucceeded, SuccessCallback = MoveTemp(SuccessCallback), ErrorCallback = MoveTemp(ErrorCallback)]() mutable
+	{
+		TSharedRef<OutStructType, ESPMode::ThreadSafe> Response = MakeShared<OutStructType, ESPMode::ThreadSafe>();
+		XsollaHttpRequestError OutError;
+		const bool bParsed = ParseResponseAsStruct(HttpRequest, HttpResponse, bSucceeded, OutStructType::StaticStruct(), &Response.Get(), OutError);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakOwner, bParsed, Response, OutError, SuccessCallback = MoveTemp(SuccessCallback), ErrorCallback = MoveTemp(ErrorCallback)]()
+		{
+			if (!WeakOwner.IsValid())
+			{
+				return;
+			}
+
+			bParsed ? SuccessCallback(Response.Get()) : ErrorCallback(OutError);
+		});
+	});
+}
+
 template <typename OutStructType>
 bool XsollaUtilsHttpRequestHelper::ParseResponseAsArray(FHttpRequestPtr HttpRequest, FHttpResponsePtr HttpResponse, const bool bSucceeded, TArray<OutStructType>* OutResponse, XsollaHttpRequestError& OutError)
 {
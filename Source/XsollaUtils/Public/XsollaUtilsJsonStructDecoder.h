@@ -0,0 +1,88 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "XsollaUtilsJsonStructReader.h"
+
+/**
+ * Reflection-free decoder of a USTRUCT built from the list of its fields.
+ *
+ * Listed fields are matched by name and read with typed readers, fields that aren't listed fall back to
+ * reflection, so the list may be partial. Decoders must be registered at module startup:
+ *
+ *	TXsollaJsonStructDecoder<FStoreItem>()
+ *		.Field("sku", &FStoreItem::sku)
+ *		.Register();
+ */
+template <typename StructType>
+class TXsollaJsonStructDecoder
+{
+public:
+	/** Adds a field. The name must be a string literal matching the JSON field. */
+	template <typename FieldType>
+	TXsollaJsonStructDecoder& Field(const ANSICHAR* Name, FieldType StructType::*Member)
+	{
+		FFieldEntry& Entry = Fields.AddDefaulted_GetRef();
+		Entry.Name = Name;
+		Entry.NameLength = FCStringAnsi::Strlen(Name);
+		Entry.Reader = [Member](XsollaUtilsJsonStructReader& Reader, StructType& Struct)
+		{
+			return Reader.ReadValue(Struct.*Member);
+		};
+		return *this;
+	}
+
+	void Register()
+	{
+		GetRegisteredFields() = MoveTemp(Fields);
+		XsollaUtilsJsonStructReader::RegisterStructDecoder(StructType::StaticStruct(), &Decode);
+	}
+
+	static void Unregister()
+	{
+		XsollaUtilsJsonStructReader::UnregisterStructDecoder(StructType::StaticStruct());
+		GetRegisteredFields().Empty();
+	}
+
+private:
+	struct FFieldEntry
+	{
+		const ANSICHAR* Name = nullptr;
+		int32 NameLength = 0;
+		TFunction<bool(XsollaUtilsJsonStructReader&, StructType&)> Reader;
+	};
+
+	static TArray<FFieldEntry>& GetRegisteredFields()
+	{
+		static TArray<FFieldEntry> RegisteredFields;
+		return RegisteredFields;
+	}
+
+	static bool Decode(XsollaUtilsJsonStructReader& Reader, void* OutStruct)
+	{
+		StructType& Struct = *static_cast<StructType*>(OutStruct);
+		const TArray<FFieldEntry>& RegisteredFields = GetRegisteredFields();
+
+		// Fields usually come in the same order, so the search starts right after the previous match
+		int32 NextIndex = 0;
+		return Reader.ReadObjectFields([&Reader, &Struct, &RegisteredFields, &NextIndex](FUtf8StringView FieldName)
+		{
+			for (int32 Offset = 0; Offset < RegisteredFields.Num(); ++Offset)
+			{
+				const int32 Index = (NextIndex + Offset) % RegisteredFields.Num();
+				const FFieldEntry& Entry = RegisteredFields[Index];
+				if (Entry.NameLength == FieldName.Len()
+					&& FCStringAnsi::Strnicmp(Entry.Name, reinterpret_cast<const ANSICHAR*>(FieldName.GetData()), Entry.NameLength) == 0)
+				{
+					NextIndex = Index + 1;
+					return Reader.ConsumeNull() || Entry.Reader(Reader, Struct);
+				}
+			}
+
+			return Reader.ReadStructField(StructType::StaticStruct(), FieldName, &Struct);
+		});
+	}
+
+	TArray<FFieldEntry> Fields;
+};
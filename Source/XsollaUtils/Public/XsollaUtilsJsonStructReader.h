@@ -0,0 +1,136 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+class FProperty;
+class FNumericProperty;
+
+/**
+ * Single-pass JSON decoder that reads UTF-8 bytes and writes values straight into UStruct properties.
+ *
+ * Follows FJsonObjectConverter rules: field names are matched case-insensitively, unknown fields and nulls
+ * are skipped, numbers and strings are converted into each other where the converter does so. Values
+ * it can't convert (object properties, static arrays, etc.) make it fail, so callers can fall back to the DOM path.
+ */
+class XSOLLAUTILS_API XsollaUtilsJsonStructReader
+{
+public:
+	XsollaUtilsJsonStructReader(const uint8* InData, const int32 InSize);
+
+	/** Decodes JSON object from the buffer into the struct. Returns false if JSON is malformed or can't be converted. */
+	static bool ReadStruct(const TArray<uint8>& Content, const UStruct* StructDefinition, void* OutStruct);
+
+	/** Decoder of a particular struct that replaces reflective decoding. Must read the whole JSON object. */
+	typedef bool (*FStructDecoder)(XsollaUtilsJsonStructReader& Reader, void* OutStruct);
+
+	/** Registers decoder for the struct. Decoders are looked up from worker threads, so register them at module startup only. */
+	static void RegisterStructDecoder(const UScriptStruct* Struct, FStructDecoder Decoder);
+	static void UnregisterStructDecoder(const UScriptStruct* Struct);
+
+	/** Reads JSON object into the struct and leaves the cursor after the closing brace. */
+	bool ReadStructValue(const UStruct* StructDefinition, void* OutStruct);
+
+	/** Reads JSON object calling FieldReader for each field. FieldReader must consume the field value. */
+	bool ReadObjectFields(TFunctionRef<bool(FUtf8StringView FieldName)> FieldReader);
+
+	/** Reads field value into the matching struct property, skips the value if there is no such property. */
+	bool ReadStructField(const UStruct* StructDefinition, FUtf8StringView FieldName, void* OutStruct);
+
+	/** Reads any JSON value into a single property value. */
+	bool ReadPropertyValue(const FProperty* Property, void* ValuePtr);
+
+	/** Typed readers with the same conversion rules as ReadPropertyValue. */
+	bool ReadValue(FString& OutValue);
+	bool ReadValue(bool& OutValue);
+	bool ReadValue(int32& OutValue);
+	bool ReadValue(int64& OutValue);
+	bool ReadValue(float& OutValue);
+	bool ReadValue(double& OutValue);
+	bool ReadValue(FDateTime& OutValue);
+
+	template <typename ElementType>
+	bool ReadValue(TArray<ElementType>& OutValue);
+
+	/** Reads nested USTRUCT. */
+	template <typename StructType>
+	bool ReadValue(StructType& OutValue);
+
+	bool ReadString(FString& OutString);
+	bool SkipValue();
+
+	/** Consumes `null` if it is the next value. */
+	bool ConsumeNull();
+
+	/** Returns true if there is nothing but whitespace left. */
+	bool IsAtEnd();
+
+private:
+	struct FJsonNumber
+	{
+		double Double = 0.0;
+		int64 Integer = 0;
+	};
+
+	bool SkipWhitespace();
+	bool Consume(const ANSICHAR Char);
+	bool ConsumeLiteral(const ANSICHAR* Literal, const int32 Length);
+	ANSICHAR PeekChar();
+
+	bool ReadEscape(FString& OutString);
+	bool SkipString();
+	bool ReadNumber(FJsonNumber& OutNumber);
+
+	/** Reads number, numeric string or boolean as FJsonValue::TryGetNumber does. */
+	bool ReadNumberValue(FJsonNumber& OutNumber, const bool bFloatingPoint);
+	bool ReadNumericValue(const FNumericProperty* Property, void* ValuePtr);
+	bool ReadEnumValue(const UEnum* Enum, const FNumericProperty* UnderlyingProperty, void* ValuePtr);
+	bool ReadBoolValue(bool& OutValue);
+
+	/** Reads string value. Numbers and booleans are converted to string as FJsonValue::AsString does. */
+	bool ReadStringValue(FString& OutString);
+
+	const uint8* Cur;
+	const uint8* End;
+
+	/** Nesting depth of skipped values, guards against stack overflow on hostile input. */
+	int32 SkipDepth;
+
+	static TMap<const UStruct*, FStructDecoder> StructDecoders;
+};
+
+template <typename ElementType>
+bool XsollaUtilsJsonStructReader::ReadValue(TArray<ElementType>& OutValue)
+{
+	if (!Consume('['))
+	{
+		return false;
+	}
+
+	OutValue.Reset();
+
+	if (Consume(']'))
+	{
+		return true;
+	}
+
+	do
+	{
+		// Null elements stay default initialized as FJsonObjectConverter leaves them
+		ElementType& Element = OutValue.AddDefaulted_GetRef();
+		if (!ConsumeNull() && !ReadValue(Element))
+		{
+			return false;
+		}
+	} while (Consume(','));
+
+	return Consume(']');
+}
+
+template <typename StructType>
+bool XsollaUtilsJsonStructReader::ReadValue(StructType& OutValue)
+{
+	return ReadStructValue(StructType::StaticStruct(), &OutValue);
+}
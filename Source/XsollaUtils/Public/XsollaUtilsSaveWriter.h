@@ -0,0 +1,111 @@
+// Copyright 2024 Xsolla Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+
+class USaveGame;
+
+/**
+ * Writes save games to slots asynchronously.
+ *
+ * Saves of the same slot scheduled within the coalescing window are written once with the latest data. Data
+ * preparation (e.g. encryption) and disk writes are done on worker threads, only the save game object is created
+ * and serialized on the game thread. Flush writes all scheduled saves, including the ones in progress, before it returns.
+ */
+class XSOLLAUTILS_API XsollaUtilsSaveWriter
+{
+public:
+	static XsollaUtilsSaveWriter& Get();
+
+	/**
+	 * Schedules save game write. Must be called on the game thread.
+	 *
+	 * @param SlotName Save slot name. Slots are identified by name only.
+	 * @param UserIndex User index of the slot.
+	 * @param PrepareData Called on a worker thread before the save game is created. May be empty.
+	 * @param CreateSaveGame Called on the game thread to create the save game object written to the slot.
+	 */
+	void ScheduleSave(const FString& SlotName, const int32 UserIndex, TFunction<void()> PrepareData, TFunction<USaveGame*()> CreateSaveGame);
+
+	/**
+	 * Schedules write of raw data (e.g. text) to the slot through the platform save system. Must be called on the game thread.
+	 *
+	 * @param SlotName Save slot name. Slots are identified by name only.
+	 * @param UserIndex User index of the slot.
+	 * @param SerializeData Called on a worker thread to produce slot data.
+	 * @param bWriteNow Starts the write right away instead of waiting for the coalescing window, for data that must survive a crash.
+	 */
+	void ScheduleDataSave(const FString& SlotName, const int32 UserIndex, TFunction<void(TArray<uint8>&)> SerializeData, const bool bWriteNow = false);
+
+	/** Writes all scheduled saves synchronously. Called before slots are loaded, before the app exits or goes to background. */
+	void Flush();
+
+	/** Unbinds from engine delegates. Called on module shutdown. */
+	void Shutdown();
+
+private:
+	XsollaUtilsSaveWriter();
+
+	struct FSave
+	{
+		FString SlotName;
+		int32 UserIndex = 0;
+
+		/** Saves are numbered so that older data finished later doesn't overwrite newer data. */
+		uint64 Version = 0;
+
+		TFunction<void()> PrepareData;
+		TFunction<USaveGame*()> CreateSaveGame;
+
+		/** Produces raw slot data on any thread, used instead of the save game object. */
+		TFunction<void(TArray<uint8>&)> SerializeData;
+
+		/** Set once the data is prepared on a worker thread. */
+		TFuture<void> PrepareTask;
+
+		/** Whether the save game is serialized. The rest of the work is done either by the pipeline or by Flush, whichever comes first. */
+		bool bIsSerialized = false;
+
+		/** Set once the serialized data is being written on a worker thread. */
+		TFuture<void> WriteTask;
+	};
+
+	bool OnFlushTimer(float DeltaTime);
+
+	void AddPendingSave(const TSharedRef<FSave>& Save);
+
+	/** Removes saves that are written from the list of saves in progress. */
+	void RemoveCompletedSaves();
+
+	/** Prepares data on a worker thread, serializes it on the game thread and writes it on a worker thread. Raw data is produced and written on a worker thread. */
+	void StartSave(const TSharedRef<FSave>& Save);
+	void SerializeAndWriteAsync(const TSharedRef<FSave>& Save);
+
+	/** Completes the save on the game thread, waiting for its worker thread tasks. */
+	void CompleteSave(const TSharedRef<FSave>& Save);
+
+	static bool SerializeSave(const FSave& Save, TArray<uint8>& OutData);
+	void WriteData(const FSave& Save, const TArray<uint8>& Data);
+
+	/** How long (in seconds) saves are collected before being written. */
+	float CoalescingWindow;
+
+	/** Scheduled saves waiting for the coalescing window to end. */
+	TMap<FString, TSharedRef<FSave>> PendingSaves;
+
+	/** Saves in progress. */
+	TArray<TSharedRef<FSave>> ActiveSaves;
+
+	uint64 LastVersion;
+	FTSTicker::FDelegateHandle FlushTimerHandle;
+	FDelegateHandle EnterBackgroundHandle;
+	FDelegateHandle PreExitHandle;
+
+	/** Version of the last written data of each slot. */
+	TMap<FString, uint64> WrittenVersions;
+	FCriticalSection WriteLock;
+};
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "XsollaUtilsTokenParser.generated.h"
 
@@ -21,6 +22,9 @@ public:
 	/** Parses a JWT token and gets its payload as a JSON object. */
 	static bool ParseTokenPayload(const FString& Token, TSharedPtr<FJsonObject>& PayloadJsonObject);
 
+	/** Removes parsed payloads of all tokens from cache, e.g. on logout. */
+	static void ClearTokenCache();
+
 	/** Extract Param from token
 	 * Extracts the string parameter with specified name from Token string.
 	 *
@@ -38,4 +42,20 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "Xsolla|Utils")
 	static UPARAM(DisplayName = "IsSuccessfull") bool GetInt64TokenParam(const FString& Token, const FString& ParamName, int64& ParamValue);
+
+private:
+	/** Gets token payload from cache, parsing the token only on the first lookup. */
+	static TSharedPtr<const FJsonObject> GetTokenPayload(const FString& Token);
+
+	struct FTokenCacheEntry
+	{
+		uint32 TokenHash = 0;
+		FString Token;
+		TSharedPtr<const FJsonObject> Payload;
+	};
+
+	/** Recently used tokens, the most recent first. Usually only the current user and payment tokens are looked up. */
+	static TArray<FTokenCacheEntry> TokenCache;
+	static FCriticalSection TokenCacheLock;
+	static constexpr int32 TokenCacheCapacity = 4;
 };
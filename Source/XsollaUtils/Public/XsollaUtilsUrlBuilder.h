@@ -3,6 +3,37 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Misc/Optional.h"
+
+/**
+ * URL template split into literal and placeholder segments once. Keep constant endpoints in function-local statics,
+ * so they aren't parsed on every call:
+ *
+ *	static const XsollaUtilsUrlTemplate UrlTemplate(TEXT("https://store.xsolla.com/api/v2/project/{ProjectID}/items/groups"));
+ */
+class XSOLLAUTILS_API XsollaUtilsUrlTemplate
+{
+public:
+	explicit XsollaUtilsUrlTemplate(const FString& UrlTemplate);
+
+private:
+	friend class XsollaUtilsUrlBuilder;
+
+	struct FSegment
+	{
+		/** Literal text or placeholder name without braces. */
+		FString Text;
+		bool bIsPlaceholder = false;
+	};
+
+	TArray<FSegment> Segments;
+
+	/** Total length of literal segments. */
+	int32 LiteralLength;
+
+	/** Whether the template already has a query string. */
+	bool bHasQuery;
+};
 
 class XSOLLAUTILS_API XsollaUtilsUrlBuilder
 {
@@ -12,6 +43,10 @@ public:
 	 */
 	XsollaUtilsUrlBuilder(const FString& UrlTemplate);
 
+	/** Uses pre-parsed template, which must outlive the builder. */
+	XsollaUtilsUrlBuilder(const XsollaUtilsUrlTemplate& UrlTemplate);
+
+	/** Builds URL in a single pass. Path and query param values are percent-encoded, so pass them unencoded. */
 	FString Build();
 
 	XsollaUtilsUrlBuilder& SetPathParam(const FString& ParamName, const FString& ParamValue);
@@ -25,10 +60,16 @@ public:
 	XsollaUtilsUrlBuilder& AddBoolQueryParam(const FString& ParamName, const bool ParamValue, const bool AsNumber = true);
 
 private:
-	FString Url;
+	const XsollaUtilsUrlTemplate& GetTemplate() const;
+
+	/** Template parsed from the string passed to the constructor. */
+	TOptional<XsollaUtilsUrlTemplate> OwnedTemplate;
+
+	/** Pre-parsed template passed to the constructor. */
+	const XsollaUtilsUrlTemplate* SharedTemplate;
 
 	TArray<TPair<FString, FString>> PathParams;
 
 	TArray<TPair<FString, FString>> StringQueryParams;
 	TArray<TPair<FString, int32>> NumberQueryParams;
-};
\ No newline at end of file
+};
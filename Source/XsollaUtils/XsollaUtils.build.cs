@@ -25,6 +25,13 @@ namespace UnrealBuildTool.Rules
                 }
             );
 
+            PrivateDependencyModuleNames.AddRange(
+                new string[]
+                {
+                    "XsollaSettings"
+                }
+            );
+
             PublicDefinitions.Add("WITH_XSOLLA_UTILS=1");
         }
     }